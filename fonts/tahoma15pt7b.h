@@ -251,7 +251,7 @@ const uint8_t tahoma15pt7bBitmaps[] PROGMEM = {
   0xE0, 0x0E, 0x01, 0xC0, 0xFC, 0x0F, 0x00, 0x1E, 0x01, 0x9F, 0x80, 0xD8,
   0xE0, 0x6C, 0x38, 0x3C, 0x1C, 0x36, 0x07, 0x1B, 0x01, 0xF9, 0x80, 0x78 };
 
-const GFXglyph tahoma15pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph tahoma15pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,   9,    0,    0 },   // 0x20 ' '
   {     1,   3,  21,  10,    3,  -20 },   // 0x21 '!'
   {     9,   8,   8,  12,    2,  -21 },   // 0x22 '"'
@@ -348,7 +348,7 @@ const GFXglyph tahoma15pt7bGlyphs[] PROGMEM = {
   {  2953,  12,  28,  14,    1,  -21 },   // 0x7D '}'
   {  2995,  17,   8,  21,    2,  -13 } }; // 0x7E '~'
 
-const GFXfont tahoma15pt7b PROGMEM = {
+constexpr GFXfont tahoma15pt7b PROGMEM = {
   (uint8_t  *)tahoma15pt7bBitmaps,
   (GFXglyph *)tahoma15pt7bGlyphs,
   0x20, 0x7E, 35 };
@@ -0,0 +1,557 @@
+const uint8_t tahoma20pt7bBitmaps[] PROGMEM = {
+  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+  0x00, 0xFF, 0xFF, 0xF1, 0xFE, 0x3F, 0xC7, 0xF8, 0xFF, 0x1F, 0xE3, 0xFC,
+  0x7B, 0x06, 0x60, 0xCC, 0x19, 0x83, 0x00, 0x00, 0x38, 0x70, 0x00, 0x70,
+  0xE0, 0x01, 0xC3, 0x80, 0x03, 0x87, 0x00, 0x07, 0x0E, 0x00, 0x0E, 0x1C,
+  0x00, 0x38, 0x70, 0x00, 0x70, 0xE0, 0x3F, 0xFF, 0xFE, 0x7F, 0xFF, 0xFC,
+  0xFF, 0xFF, 0xF8, 0x0E, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x38, 0x70, 0x00,
+  0xE1, 0xC0, 0x01, 0xC3, 0x80, 0x03, 0x87, 0x00, 0x07, 0x0E, 0x03, 0xFF,
+  0xFF, 0xE7, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0x80, 0xE1, 0xC0, 0x03, 0x87,
+  0x00, 0x07, 0x0E, 0x00, 0x0E, 0x1C, 0x00, 0x1C, 0x38, 0x00, 0x70, 0xE0,
+  0x00, 0xE1, 0xC0, 0x00, 0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30,
+  0x00, 0x18, 0x00, 0x3F, 0xC0, 0x7F, 0xFC, 0x7F, 0xFE, 0x7D, 0x8F, 0x7C,
+  0xC0, 0xBC, 0x60, 0x1E, 0x30, 0x0F, 0x18, 0x07, 0x8C, 0x03, 0xE6, 0x00,
+  0xFF, 0x00, 0x3F, 0xE0, 0x0F, 0xFE, 0x00, 0x7F, 0x80, 0x33, 0xE0, 0x18,
+  0xF8, 0x0C, 0x3C, 0x06, 0x1E, 0x03, 0x0F, 0x81, 0x87, 0xE0, 0xC7, 0xBE,
+  0x67, 0xDF, 0xFF, 0xC7, 0xFF, 0x80, 0xFF, 0x00, 0x06, 0x00, 0x03, 0x00,
+  0x01, 0x80, 0x00, 0xC0, 0x00, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x0F,
+  0x80, 0x00, 0x00, 0x0F, 0xF8, 0x00, 0xF0, 0x07, 0xFF, 0x00, 0x38, 0x01,
+  0xE3, 0xC0, 0x1E, 0x00, 0xF0, 0x70, 0x07, 0x00, 0x38, 0x0E, 0x03, 0xC0,
+  0x0E, 0x03, 0x80, 0xE0, 0x03, 0x80, 0xE0, 0x78, 0x00, 0xE0, 0x38, 0x1C,
+  0x00, 0x38, 0x0E, 0x0F, 0x00, 0x0E, 0x03, 0x83, 0x80, 0x03, 0x80, 0xE1,
+  0xC0, 0x00, 0xF0, 0x78, 0x70, 0x7C, 0x1E, 0x3C, 0x38, 0x7F, 0xC7, 0xFF,
+  0x0E, 0x3F, 0xF8, 0xFF, 0x87, 0x0F, 0x1E, 0x0F, 0x81, 0xC7, 0x83, 0x80,
+  0x00, 0xE1, 0xC0, 0x70, 0x00, 0x38, 0x70, 0x1C, 0x00, 0x1C, 0x1C, 0x07,
+  0x00, 0x0F, 0x07, 0x01, 0xC0, 0x03, 0x81, 0xC0, 0x70, 0x01, 0xE0, 0x70,
+  0x1C, 0x00, 0x70, 0x1C, 0x07, 0x00, 0x3C, 0x07, 0x83, 0xC0, 0x0E, 0x00,
+  0xF1, 0xE0, 0x07, 0x80, 0x3F, 0xF8, 0x01, 0xC0, 0x07, 0xFC, 0x00, 0xF0,
+  0x00, 0x7C, 0x00, 0x03, 0xF0, 0x00, 0x03, 0xFF, 0x00, 0x01, 0xFF, 0xE0,
+  0x00, 0xF8, 0xF8, 0x00, 0x7C, 0x1F, 0x00, 0x1E, 0x03, 0xC0, 0x07, 0x80,
+  0xF0, 0x01, 0xE0, 0x3C, 0x00, 0x78, 0x0F, 0x00, 0x0F, 0x07, 0x80, 0x03,
+  0xE1, 0xC0, 0x00, 0x7F, 0xE0, 0x00, 0x0F, 0xF0, 0x78, 0x03, 0xF8, 0x1E,
+  0x01, 0xDF, 0x07, 0x80, 0xE3, 0xE1, 0xE0, 0x78, 0x7C, 0x78, 0x1C, 0x0F,
+  0x9E, 0x0F, 0x01, 0xF7, 0x03, 0xC0, 0x3F, 0xC0, 0xF0, 0x07, 0xF0, 0x3C,
+  0x00, 0xF8, 0x0F, 0x00, 0x1F, 0x03, 0xE0, 0x07, 0xE0, 0x7C, 0x03, 0xFC,
+  0x1F, 0x81, 0xEF, 0x83, 0xFF, 0xF1, 0xF0, 0x7F, 0xF0, 0x3E, 0x07, 0xF0,
+  0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xF6, 0x66, 0x60, 0x03, 0xE0, 0x78, 0x1E,
+  0x07, 0x80, 0xE0, 0x3C, 0x07, 0x01, 0xE0, 0x38, 0x0F, 0x01, 0xC0, 0x38,
+  0x07, 0x01, 0xE0, 0x38, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E,
+  0x01, 0xC0, 0x38, 0x07, 0x00, 0xF0, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x80,
+  0x70, 0x0F, 0x00, 0xE0, 0x1E, 0x01, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x07,
+  0xC0, 0xF8, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xE0, 0x1E, 0x01, 0xC0, 0x3C,
+  0x03, 0x80, 0x78, 0x07, 0x00, 0xE0, 0x1C, 0x03, 0xC0, 0x38, 0x07, 0x00,
+  0xE0, 0x1C, 0x03, 0x80, 0x70, 0x0E, 0x01, 0xC0, 0x38, 0x07, 0x01, 0xE0,
+  0x38, 0x07, 0x00, 0xE0, 0x3C, 0x07, 0x01, 0xE0, 0x38, 0x0F, 0x01, 0xC0,
+  0x78, 0x1E, 0x07, 0x81, 0xF0, 0x00, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x70,
+  0x08, 0x38, 0x2E, 0x1C, 0x3B, 0xCE, 0x78, 0xF7, 0x78, 0x1F, 0xF0, 0x03,
+  0xE0, 0x01, 0xF0, 0x03, 0xFE, 0x07, 0xBB, 0xC7, 0x9C, 0xF7, 0x0E, 0x1D,
+  0x07, 0x04, 0x03, 0x80, 0x01, 0xC0, 0x00, 0xE0, 0x00, 0x00, 0x38, 0x00,
+  0x00, 0x70, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00,
+  0x07, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00,
+  0x70, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x07,
+  0x00, 0x00, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x38, 0x00, 0x00, 0x70,
+  0x00, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00,
+  0x00, 0x0E, 0x00, 0x00, 0x1F, 0x1E, 0x1E, 0x3C, 0x3C, 0x3C, 0x38, 0x78,
+  0x70, 0x70, 0xE0, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0xFF, 0xFF, 0xFF,
+  0x80, 0x00, 0x1C, 0x00, 0xF0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x01, 0xC0,
+  0x07, 0x00, 0x1C, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x78, 0x01, 0xC0,
+  0x07, 0x00, 0x3C, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x70, 0x01, 0xC0,
+  0x07, 0x00, 0x3C, 0x00, 0xE0, 0x03, 0x80, 0x1E, 0x00, 0x70, 0x01, 0xC0,
+  0x07, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x1C, 0x00, 0x70, 0x01, 0xC0,
+  0x0F, 0x00, 0x38, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0xF8,
+  0x7C, 0x3C, 0x0F, 0x1E, 0x01, 0xE7, 0x80, 0x79, 0xE0, 0x1E, 0xF0, 0x03,
+  0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x03, 0xDC, 0x01, 0xE7, 0x80, 0x79, 0xE0, 0x1E, 0x3C, 0x0F,
+  0x0F, 0x87, 0xC1, 0xFF, 0xE0, 0x3F, 0xF0, 0x03, 0xF0, 0x00, 0x03, 0x80,
+  0x1E, 0x00, 0x78, 0x03, 0xE0, 0xFF, 0x83, 0xFE, 0x0F, 0xF8, 0x01, 0xE0,
+  0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78,
+  0x01, 0xE0, 0x07, 0x80, 0x1E, 0x00, 0x78, 0x01, 0xE0, 0x07, 0x80, 0x1E,
+  0x00, 0x78, 0x01, 0xE0, 0x07, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F,
+  0xE0, 0x1F, 0xFC, 0x1F, 0xFF, 0x0F, 0x07, 0xC6, 0x01, 0xE2, 0x00, 0x78,
+  0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x03,
+  0xC0, 0x01, 0xE0, 0x01, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF8, 0x00,
+  0xF8, 0x00, 0xF8, 0x00, 0xF8, 0x00, 0x78, 0x00, 0x78, 0x00, 0x78, 0x00,
+  0x78, 0x00, 0x78, 0x00, 0x78, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x0F, 0xE0, 0x1F, 0xFC, 0x1F, 0xFF, 0x8F, 0x07, 0xC6, 0x01, 0xF2,
+  0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00, 0x07, 0x00, 0x07,
+  0x80, 0x0F, 0x80, 0x3F, 0x80, 0x1F, 0x00, 0x0F, 0xF0, 0x00, 0x3C, 0x00,
+  0x0F, 0x00, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C,
+  0x00, 0x1F, 0x00, 0x1E, 0xC0, 0x1F, 0x7C, 0x1F, 0x3F, 0xFF, 0x0F, 0xFF,
+  0x00, 0xFE, 0x00, 0x00, 0x0F, 0x00, 0x03, 0xE0, 0x00, 0xFC, 0x00, 0x3F,
+  0x80, 0x0E, 0xF0, 0x03, 0x9E, 0x00, 0x73, 0xC0, 0x1C, 0x78, 0x07, 0x0F,
+  0x01, 0xC1, 0xE0, 0x70, 0x3C, 0x1C, 0x07, 0x87, 0x00, 0xF1, 0xE0, 0x1E,
+  0x38, 0x03, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3C,
+  0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0x00, 0x78,
+  0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x7F, 0xFF,
+  0xBF, 0xFF, 0xDF, 0xFF, 0xEF, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0,
+  0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1F, 0xFC, 0x0F, 0xFF, 0x87,
+  0xFF, 0xE3, 0x01, 0xF8, 0x00, 0x3C, 0x00, 0x1F, 0x00, 0x07, 0x80, 0x03,
+  0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x3D, 0x80,
+  0x3E, 0xF8, 0x3E, 0x7F, 0xFE, 0x3F, 0xFE, 0x03, 0xFC, 0x00, 0x00, 0x7F,
+  0x00, 0xFF, 0xC0, 0x7F, 0xF0, 0x3F, 0x04, 0x1F, 0x00, 0x0F, 0x80, 0x03,
+  0xC0, 0x01, 0xE0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x07, 0x00, 0x03, 0xC7,
+  0xE0, 0xF7, 0xFE, 0x3F, 0xFF, 0xCF, 0xC1, 0xFB, 0xC0, 0x1E, 0xF0, 0x07,
+  0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xDC, 0x00, 0xF7,
+  0x80, 0x3D, 0xE0, 0x1E, 0x3C, 0x07, 0x8F, 0x87, 0xC1, 0xFF, 0xE0, 0x3F,
+  0xF0, 0x03, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+  0x0F, 0x00, 0x07, 0xC0, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x1F,
+  0x00, 0x07, 0x80, 0x03, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x1E, 0x00,
+  0x0F, 0x80, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x1E, 0x00, 0x0F,
+  0x00, 0x03, 0xC0, 0x01, 0xF0, 0x00, 0x78, 0x00, 0x3E, 0x00, 0x0F, 0x00,
+  0x07, 0xC0, 0x01, 0xE0, 0x00, 0xF8, 0x00, 0x03, 0xF0, 0x03, 0xFF, 0x01,
+  0xFF, 0xE0, 0xF8, 0x7C, 0x3C, 0x0F, 0x9E, 0x01, 0xE7, 0x80, 0x79, 0xE0,
+  0x1E, 0x78, 0x07, 0x9F, 0x01, 0xE3, 0xE0, 0x70, 0xFE, 0x3C, 0x1F, 0xFE,
+  0x01, 0xFE, 0x01, 0xFF, 0xE0, 0xF1, 0xFC, 0x78, 0x1F, 0x9E, 0x01, 0xEF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xE0,
+  0x1E, 0x7C, 0x07, 0x9F, 0x87, 0xC3, 0xFF, 0xF0, 0x7F, 0xF0, 0x03, 0xF0,
+  0x00, 0x03, 0xF0, 0x03, 0xFF, 0x01, 0xFF, 0xE0, 0xF8, 0x7C, 0x78, 0x0F,
+  0x1E, 0x01, 0xEF, 0x00, 0x7B, 0xC0, 0x0E, 0xF0, 0x03, 0xFC, 0x00, 0xFF,
+  0x00, 0x3F, 0xC0, 0x0F, 0xF8, 0x03, 0xDE, 0x00, 0xF7, 0xE0, 0xFC, 0xFF,
+  0xFF, 0x1F, 0xFB, 0xC1, 0xF8, 0xF0, 0x00, 0x38, 0x00, 0x1E, 0x00, 0x07,
+  0x80, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x7C, 0x00, 0x3E, 0x08, 0x1F, 0x03,
+  0xFF, 0x80, 0xFF, 0xC0, 0x3F, 0x80, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x80, 0x3E, 0x3E, 0x3E,
+  0x3E, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x1F, 0x1E, 0x1E, 0x3C, 0x3C, 0x3C, 0x38, 0x78, 0x70, 0x70, 0xE0,
+  0xE0, 0x00, 0x00, 0x10, 0x00, 0x07, 0x00, 0x01, 0xF0, 0x00, 0x7E, 0x00,
+  0x1F, 0x80, 0x07, 0xE0, 0x01, 0xF8, 0x00, 0xFE, 0x00, 0x3F, 0x80, 0x0F,
+  0xE0, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x3F, 0x80, 0x00, 0xFE, 0x00,
+  0x01, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x1F, 0x80, 0x00, 0x7F, 0x00, 0x01,
+  0xF0, 0x00, 0x07, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x80,
+  0x00, 0x0E, 0x00, 0x00, 0xF8, 0x00, 0x0F, 0xE0, 0x00, 0x1F, 0x80, 0x00,
+  0x7E, 0x00, 0x01, 0xF8, 0x00, 0x07, 0xF0, 0x00, 0x1F, 0xC0, 0x00, 0x7F,
+  0x00, 0x01, 0xF0, 0x00, 0x7F, 0x00, 0x1F, 0xC0, 0x07, 0xF0, 0x01, 0xF8,
+  0x00, 0x7E, 0x00, 0x1F, 0x80, 0x07, 0xE0, 0x00, 0xF8, 0x00, 0x0E, 0x00,
+  0x00, 0x80, 0x00, 0x00, 0x1F, 0xC1, 0xFF, 0xE3, 0xFF, 0xE7, 0x03, 0xE8,
+  0x03, 0xE0, 0x03, 0xC0, 0x07, 0x80, 0x0F, 0x00, 0x1E, 0x00, 0x3C, 0x00,
+  0xF0, 0x03, 0xE0, 0x0F, 0x80, 0x3E, 0x01, 0xF8, 0x07, 0xC0, 0x0E, 0x00,
+  0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x00, 0x00,
+  0x1F, 0xF0, 0x00, 0x01, 0xFF, 0xF0, 0x00, 0x1F, 0xFF, 0xF0, 0x00, 0xFC,
+  0x07, 0xE0, 0x07, 0x80, 0x07, 0xC0, 0x3C, 0x00, 0x07, 0x81, 0xE0, 0x00,
+  0x0F, 0x0F, 0x03, 0xEE, 0x1C, 0x38, 0x3F, 0xF8, 0x79, 0xE1, 0xFF, 0xE0,
+  0xE7, 0x0F, 0x07, 0x83, 0x9C, 0x38, 0x0E, 0x0E, 0xE0, 0xE0, 0x38, 0x1F,
+  0x87, 0x00, 0xE0, 0x7E, 0x1C, 0x03, 0x81, 0xF8, 0x70, 0x0E, 0x07, 0xE1,
+  0xC0, 0x38, 0x1F, 0x87, 0x00, 0xE0, 0x7E, 0x1C, 0x03, 0x81, 0xF8, 0x70,
+  0x0E, 0x07, 0xE1, 0xE0, 0x38, 0x1D, 0xC3, 0x81, 0xE0, 0xE7, 0x0F, 0x0F,
+  0x83, 0x9E, 0x1F, 0xFE, 0x0C, 0x38, 0x7F, 0xBF, 0xF0, 0xF0, 0x7C, 0xFF,
+  0x81, 0xE0, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x00,
+  0x0F, 0xC0, 0x30, 0x00, 0x1F, 0xFF, 0xC0, 0x00, 0x1F, 0xFF, 0x00, 0x00,
+  0x1F, 0xF8, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF8, 0x00, 0x03, 0xF8, 0x00,
+  0x07, 0xF0, 0x00, 0x0F, 0xE0, 0x00, 0x3D, 0xE0, 0x00, 0x7B, 0xC0, 0x00,
+  0xF7, 0x80, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00, 0x3E,
+  0x1E, 0x00, 0x78, 0x3C, 0x00, 0xF0, 0x78, 0x03, 0xE0, 0x78, 0x07, 0x80,
+  0xF0, 0x0F, 0x01, 0xE0, 0x3F, 0xFF, 0xE0, 0x7F, 0xFF, 0xC0, 0xFF, 0xFF,
+  0x83, 0xE0, 0x0F, 0x87, 0x80, 0x0F, 0x0F, 0x00, 0x1E, 0x3E, 0x00, 0x3E,
+  0x78, 0x00, 0x3C, 0xF0, 0x00, 0x7B, 0xE0, 0x00, 0xFF, 0x80, 0x00, 0xF0,
+  0xFF, 0xFC, 0x1F, 0xFF, 0xE3, 0xFF, 0xFE, 0x78, 0x07, 0xCF, 0x00, 0x7D,
+  0xE0, 0x07, 0xBC, 0x00, 0xF7, 0x80, 0x1E, 0xF0, 0x03, 0xDE, 0x00, 0xF3,
+  0xC0, 0x3C, 0x7F, 0xFF, 0x0F, 0xFF, 0xE1, 0xFF, 0xFF, 0x3C, 0x03, 0xF7,
+  0x80, 0x1E, 0xF0, 0x03, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF,
+  0x00, 0x1F, 0xE0, 0x03, 0xFC, 0x00, 0xF7, 0x80, 0x3E, 0xF0, 0x0F, 0x9F,
+  0xFF, 0xE3, 0xFF, 0xF8, 0x7F, 0xFC, 0x00, 0x00, 0x7F, 0x00, 0x1F, 0xFF,
+  0x01, 0xFF, 0xFE, 0x1F, 0x81, 0xF1, 0xF0, 0x03, 0x9F, 0x00, 0x0C, 0xF0,
+  0x00, 0x2F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x3C, 0x00, 0x01,
+  0xE0, 0x00, 0x0F, 0x00, 0x00, 0x78, 0x00, 0x03, 0xC0, 0x00, 0x1E, 0x00,
+  0x00, 0xF0, 0x00, 0x07, 0x80, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x07,
+  0x80, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x00, 0x27, 0xC0, 0x03, 0x1F, 0x00,
+  0x38, 0x7E, 0x07, 0xC1, 0xFF, 0xFE, 0x07, 0xFF, 0xC0, 0x07, 0xF0, 0x00,
+  0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x0F, 0xFF, 0xF8, 0x3C, 0x07, 0xF0, 0xF0,
+  0x07, 0xE3, 0xC0, 0x07, 0xCF, 0x00, 0x0F, 0x3C, 0x00, 0x3E, 0xF0, 0x00,
+  0x7B, 0xC0, 0x01, 0xEF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F,
+  0xC0, 0x00, 0xFF, 0x00, 0x03, 0xFC, 0x00, 0x0F, 0xF0, 0x00, 0x3F, 0xC0,
+  0x00, 0xFF, 0x00, 0x07, 0xBC, 0x00, 0x1E, 0xF0, 0x00, 0x7B, 0xC0, 0x03,
+  0xCF, 0x00, 0x1F, 0x3C, 0x00, 0xF8, 0xF0, 0x1F, 0xC3, 0xFF, 0xFE, 0x0F,
+  0xFF, 0xE0, 0x3F, 0xFC, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xFF, 0xFE, 0xFF, 0xFF, 0xBF, 0xFF,
+  0xEF, 0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFE, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0,
+  0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1F, 0xFF, 0xEF, 0xFF, 0xF7,
+  0xFF, 0xFB, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0,
+  0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x03,
+  0xFF, 0xF0, 0x1F, 0xFF, 0xF8, 0x7E, 0x03, 0xF1, 0xF0, 0x01, 0xE7, 0xC0,
+  0x00, 0xCF, 0x00, 0x00, 0xBE, 0x00, 0x00, 0x78, 0x00, 0x00, 0xF0, 0x00,
+  0x03, 0xC0, 0x00, 0x07, 0x80, 0x00, 0x0F, 0x00, 0x00, 0x1E, 0x00, 0x00,
+  0x3C, 0x01, 0xFF, 0xF8, 0x03, 0xFF, 0xF0, 0x07, 0xFF, 0xE0, 0x00, 0x3F,
+  0xC0, 0x00, 0x7B, 0xC0, 0x00, 0xF7, 0x80, 0x01, 0xEF, 0x80, 0x03, 0xCF,
+  0x00, 0x07, 0x9F, 0x00, 0x0F, 0x1F, 0x00, 0x1E, 0x1F, 0x80, 0x7C, 0x1F,
+  0xFF, 0xF8, 0x0F, 0xFF, 0xC0, 0x07, 0xFC, 0x00, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0,
+  0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x0F, 0xF8, 0x7F, 0xC3, 0xFE, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0,
+  0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01,
+  0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C,
+  0x01, 0xE0, 0x1E, 0xC1, 0xF7, 0xFF, 0x3F, 0xF1, 0xFE, 0x00, 0xF0, 0x03,
+  0xF7, 0x80, 0x3F, 0x3C, 0x03, 0xF1, 0xE0, 0x3F, 0x0F, 0x03, 0xF0, 0x78,
+  0x1F, 0x03, 0xC1, 0xF0, 0x1E, 0x1F, 0x00, 0xF1, 0xF0, 0x07, 0x9F, 0x00,
+  0x3D, 0xF0, 0x01, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0x7F, 0xC0, 0x03, 0xFF,
+  0x00, 0x1F, 0x7C, 0x00, 0xF1, 0xF0, 0x07, 0x8F, 0xC0, 0x3C, 0x3E, 0x01,
+  0xE0, 0xF8, 0x0F, 0x03, 0xE0, 0x78, 0x0F, 0x83, 0xC0, 0x7E, 0x1E, 0x01,
+  0xF0, 0xF0, 0x07, 0xC7, 0x80, 0x1F, 0x3C, 0x00, 0x7D, 0xE0, 0x03, 0xF0,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00,
+  0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x3F, 0xFC,
+  0x00, 0x3F, 0xFE, 0x00, 0x3F, 0xFE, 0x00, 0x7F, 0xFE, 0x00, 0x7F, 0xF7,
+  0x00, 0xEF, 0xF7, 0x00, 0xEF, 0xF3, 0x81, 0xCF, 0xF3, 0x81, 0xCF, 0xF3,
+  0xC1, 0xCF, 0xF1, 0xC3, 0x8F, 0xF1, 0xE3, 0x8F, 0xF0, 0xE7, 0x0F, 0xF0,
+  0xE7, 0x0F, 0xF0, 0x76, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0, 0x7E, 0x0F, 0xF0,
+  0x3C, 0x0F, 0xF0, 0x3C, 0x0F, 0xF0, 0x18, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0,
+  0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xF0, 0x00, 0x0F, 0xFC, 0x00, 0xFF, 0xC0,
+  0x0F, 0xFE, 0x00, 0xFF, 0xE0, 0x0F, 0xFF, 0x00, 0xFF, 0x70, 0x0F, 0xF7,
+  0x80, 0xFF, 0x38, 0x0F, 0xF3, 0xC0, 0xFF, 0x1C, 0x0F, 0xF1, 0xE0, 0xFF,
+  0x0E, 0x0F, 0xF0, 0xE0, 0xFF, 0x07, 0x0F, 0xF0, 0x70, 0xFF, 0x07, 0x8F,
+  0xF0, 0x38, 0xFF, 0x03, 0xCF, 0xF0, 0x1C, 0xFF, 0x01, 0xEF, 0xF0, 0x0E,
+  0xFF, 0x00, 0xFF, 0xF0, 0x07, 0xFF, 0x00, 0x7F, 0xF0, 0x03, 0xFF, 0x00,
+  0x3F, 0xF0, 0x01, 0xFF, 0x00, 0x1F, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xF8,
+  0x00, 0x7F, 0xFF, 0x80, 0x3F, 0x03, 0xF0, 0x1F, 0x00, 0x3E, 0x0F, 0x80,
+  0x07, 0xC3, 0xC0, 0x00, 0xF1, 0xE0, 0x00, 0x1E, 0x78, 0x00, 0x07, 0x9E,
+  0x00, 0x01, 0xEF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00, 0x03,
+  0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0, 0x00,
+  0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0xE0, 0x00, 0x1E, 0x78,
+  0x00, 0x07, 0x9E, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0xF0, 0xF8, 0x00, 0x7C,
+  0x1F, 0x00, 0x3E, 0x03, 0xF0, 0x3F, 0x00, 0x7F, 0xFF, 0x80, 0x0F, 0xFF,
+  0xC0, 0x00, 0x7F, 0x80, 0x00, 0xFF, 0xF0, 0x3F, 0xFF, 0x0F, 0xFF, 0xE3,
+  0xC0, 0x7C, 0xF0, 0x0F, 0xBC, 0x01, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
+  0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x0F, 0xF0, 0x07, 0xBC, 0x03,
+  0xEF, 0x03, 0xF3, 0xFF, 0xF8, 0xFF, 0xFC, 0x3F, 0xF8, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0x00, 0x7F, 0x80, 0x00,
+  0xFF, 0xF8, 0x00, 0x7F, 0xFF, 0x80, 0x3F, 0x03, 0xF0, 0x1F, 0x00, 0x3E,
+  0x0F, 0x80, 0x07, 0xC3, 0xC0, 0x00, 0xF1, 0xE0, 0x00, 0x1E, 0x78, 0x00,
+  0x07, 0x9E, 0x00, 0x01, 0xEF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F, 0xF0,
+  0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x0F,
+  0xF0, 0x00, 0x03, 0xFC, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x3D, 0xE0, 0x00,
+  0x1E, 0x78, 0x00, 0x07, 0x9E, 0x00, 0x01, 0xE3, 0xC0, 0x00, 0xF0, 0xF8,
+  0x00, 0x7C, 0x1F, 0x00, 0x3E, 0x03, 0xF0, 0x3F, 0x00, 0x7F, 0xFF, 0x80,
+  0x0F, 0xFF, 0xC0, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x0F, 0x80, 0x00, 0x01, 0xF0, 0xC0, 0x00, 0x3F, 0xF0, 0x00,
+  0x07, 0xFC, 0x00, 0x00, 0xFF, 0xFF, 0xF0, 0x03, 0xFF, 0xF8, 0x0F, 0xFF,
+  0xF0, 0x3C, 0x07, 0xE0, 0xF0, 0x07, 0x83, 0xC0, 0x1F, 0x0F, 0x00, 0x3C,
+  0x3C, 0x00, 0xF0, 0xF0, 0x03, 0xC3, 0xC0, 0x0F, 0x0F, 0x00, 0x3C, 0x3C,
+  0x01, 0xE0, 0xF0, 0x0F, 0x83, 0xC0, 0x7C, 0x0F, 0xFF, 0xE0, 0x3F, 0xFE,
+  0x00, 0xFF, 0xF0, 0x03, 0xC3, 0xE0, 0x0F, 0x07, 0xC0, 0x3C, 0x0F, 0x80,
+  0xF0, 0x1F, 0x03, 0xC0, 0x7E, 0x0F, 0x00, 0xF8, 0x3C, 0x01, 0xF0, 0xF0,
+  0x03, 0xE3, 0xC0, 0x07, 0xCF, 0x00, 0x0F, 0xBC, 0x00, 0x3F, 0x03, 0xFC,
+  0x01, 0xFF, 0xF0, 0xFF, 0xFF, 0x1F, 0x03, 0xE7, 0x80, 0x1D, 0xE0, 0x00,
+  0xBC, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xE0, 0x00,
+  0x3E, 0x00, 0x07, 0xFC, 0x00, 0x7F, 0xF8, 0x03, 0xFF, 0xC0, 0x1F, 0xFC,
+  0x00, 0x3F, 0xC0, 0x00, 0xF8, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00, 0x1E,
+  0x00, 0x03, 0xE0, 0x00, 0x7E, 0x00, 0x1E, 0xE0, 0x03, 0xDF, 0x81, 0xF3,
+  0xFF, 0xFC, 0x1F, 0xFF, 0x00, 0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0xF0, 0x00, 0xFF, 0x00, 0x0F,
+  0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00,
+  0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00,
+  0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0,
+  0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x0F, 0xF0, 0x00, 0xFF,
+  0x80, 0x1F, 0x78, 0x01, 0xE7, 0xC0, 0x3E, 0x3E, 0x07, 0xC1, 0xFF, 0xF8,
+  0x0F, 0xFF, 0x00, 0x3F, 0xC0, 0xF0, 0x00, 0x1E, 0xF0, 0x00, 0x7D, 0xE0,
+  0x00, 0xF3, 0xC0, 0x01, 0xE3, 0xC0, 0x07, 0x87, 0x80, 0x0F, 0x0F, 0x00,
+  0x1E, 0x0F, 0x00, 0x78, 0x1E, 0x00, 0xF0, 0x3C, 0x01, 0xE0, 0x3C, 0x07,
+  0x80, 0x78, 0x0F, 0x00, 0xF0, 0x1E, 0x00, 0xF0, 0x78, 0x01, 0xE0, 0xF0,
+  0x03, 0xC1, 0xE0, 0x03, 0xC7, 0x80, 0x07, 0x8F, 0x00, 0x0F, 0x1E, 0x00,
+  0x0F, 0x78, 0x00, 0x1E, 0xF0, 0x00, 0x3D, 0xE0, 0x00, 0x3F, 0x80, 0x00,
+  0x7F, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x03,
+  0xE0, 0x00, 0xF0, 0x01, 0xE0, 0x03, 0xFE, 0x00, 0x78, 0x01, 0xF7, 0x80,
+  0x1F, 0x00, 0x79, 0xE0, 0x0F, 0xC0, 0x1E, 0x78, 0x03, 0xF0, 0x07, 0x9E,
+  0x00, 0xFC, 0x01, 0xE3, 0xC0, 0x3F, 0x80, 0xF0, 0xF0, 0x1C, 0xE0, 0x3C,
+  0x3C, 0x07, 0x38, 0x0F, 0x0F, 0x01, 0xCE, 0x03, 0xC1, 0xE0, 0x73, 0xC1,
+  0xE0, 0x78, 0x38, 0xF0, 0x78, 0x1E, 0x0E, 0x1C, 0x1E, 0x07, 0x83, 0x87,
+  0x07, 0x80, 0xF0, 0xE1, 0xE3, 0xC0, 0x3C, 0x78, 0x78, 0xF0, 0x0F, 0x1C,
+  0x0E, 0x3C, 0x01, 0xC7, 0x03, 0x8F, 0x00, 0x79, 0xC0, 0xE7, 0x80, 0x1E,
+  0xF0, 0x3D, 0xE0, 0x07, 0xB8, 0x07, 0x78, 0x00, 0xEE, 0x01, 0xDE, 0x00,
+  0x3F, 0x80, 0x7F, 0x00, 0x0F, 0xE0, 0x1F, 0xC0, 0x03, 0xF0, 0x07, 0xF0,
+  0x00, 0x7C, 0x00, 0xFC, 0x00, 0x1F, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x0F,
+  0x80, 0xF8, 0x00, 0x3E, 0xF8, 0x00, 0xF8, 0xF0, 0x01, 0xE1, 0xF0, 0x07,
+  0xC1, 0xF0, 0x1F, 0x01, 0xE0, 0x3C, 0x03, 0xE0, 0xF8, 0x03, 0xE3, 0xE0,
+  0x03, 0xC7, 0x80, 0x07, 0xDF, 0x00, 0x07, 0xFC, 0x00, 0x07, 0xF0, 0x00,
+  0x0F, 0xE0, 0x00, 0x0F, 0x80, 0x00, 0x1F, 0x00, 0x00, 0x7F, 0x00, 0x00,
+  0xFE, 0x00, 0x03, 0xFE, 0x00, 0x0F, 0xBE, 0x00, 0x1E, 0x3C, 0x00, 0x7C,
+  0x7C, 0x01, 0xF0, 0x7C, 0x03, 0xC0, 0x78, 0x0F, 0x80, 0xF8, 0x3E, 0x00,
+  0xF8, 0x78, 0x00, 0xF1, 0xF0, 0x01, 0xF7, 0xC0, 0x01, 0xF0, 0xF8, 0x00,
+  0x1F, 0x7C, 0x00, 0x3E, 0x3C, 0x00, 0x3C, 0x3E, 0x00, 0x7C, 0x1F, 0x00,
+  0xF8, 0x1F, 0x00, 0xF0, 0x0F, 0x81, 0xF0, 0x07, 0x81, 0xE0, 0x07, 0xC3,
+  0xE0, 0x03, 0xE7, 0xC0, 0x01, 0xE7, 0x80, 0x01, 0xFF, 0x80, 0x00, 0xFF,
+  0x00, 0x00, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C,
+  0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x3C, 0x00, 0x7F, 0xFF,
+  0xF7, 0xFF, 0xFF, 0x7F, 0xFF, 0xF0, 0x00, 0x1F, 0x00, 0x03, 0xE0, 0x00,
+  0x3C, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x1F, 0x00, 0x01, 0xE0, 0x00,
+  0x3E, 0x00, 0x07, 0xC0, 0x00, 0x78, 0x00, 0x0F, 0x80, 0x01, 0xF0, 0x00,
+  0x1E, 0x00, 0x03, 0xE0, 0x00, 0x7C, 0x00, 0x0F, 0x80, 0x00, 0xF0, 0x00,
+  0x1F, 0x00, 0x03, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00,
+  0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0,
+  0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E,
+  0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80, 0xE0, 0x38, 0x0E, 0x03, 0x80,
+  0xE0, 0x38, 0x0F, 0xFF, 0xFF, 0xFF, 0xC0, 0xE0, 0x03, 0xC0, 0x07, 0x00,
+  0x1C, 0x00, 0x70, 0x00, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x1C, 0x00, 0x70,
+  0x01, 0xC0, 0x07, 0x80, 0x0E, 0x00, 0x38, 0x00, 0xF0, 0x01, 0xC0, 0x07,
+  0x00, 0x1C, 0x00, 0x38, 0x00, 0xE0, 0x03, 0x80, 0x0F, 0x00, 0x1C, 0x00,
+  0x70, 0x01, 0xE0, 0x03, 0x80, 0x0E, 0x00, 0x38, 0x00, 0x70, 0x01, 0xC0,
+  0x07, 0x00, 0x0E, 0x00, 0x38, 0x00, 0xE0, 0x03, 0xC0, 0x07, 0xFF, 0xFF,
+  0xFF, 0xFC, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C,
+  0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01,
+  0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70, 0x1C, 0x07, 0x01, 0xC0, 0x70,
+  0x1C, 0x07, 0x01, 0xC0, 0x7F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x38, 0x00,
+  0x00, 0xF8, 0x00, 0x01, 0xF0, 0x00, 0x07, 0x70, 0x00, 0x1E, 0xF0, 0x00,
+  0x38, 0xE0, 0x00, 0xE0, 0xE0, 0x03, 0xC1, 0xE0, 0x0F, 0x01, 0xE0, 0x1C,
+  0x01, 0xC0, 0x78, 0x03, 0xC1, 0xE0, 0x03, 0xC3, 0x80, 0x03, 0x8E, 0x00,
+  0x03, 0xBC, 0x00, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0xF8,
+  0x78, 0x3C, 0x1C, 0x1E, 0x0E, 0x07, 0x0F, 0xF8, 0x1F, 0xFF, 0x0F, 0xFF,
+  0xC7, 0x03, 0xE2, 0x00, 0xF8, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F, 0x00,
+  0xFF, 0x87, 0xFF, 0xCF, 0xFF, 0xEF, 0xF0, 0xF7, 0xC0, 0x7F, 0xC0, 0x3F,
+  0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x07, 0xDE, 0x0F, 0xEF, 0xFF,
+  0xF3, 0xFE, 0x78, 0x7C, 0x3C, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03,
+  0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0, 0x00, 0xF0,
+  0xF8, 0x3C, 0xFF, 0x8F, 0xFF, 0xF3, 0xF8, 0x7C, 0xFC, 0x07, 0xBC, 0x01,
+  0xEF, 0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F,
+  0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1E, 0xF0,
+  0x07, 0xBC, 0x03, 0xCF, 0xC1, 0xF3, 0xFF, 0xF8, 0xFF, 0xFC, 0x3C, 0xFC,
+  0x00, 0x01, 0xF8, 0x0F, 0xFF, 0x1F, 0xFF, 0x3F, 0x0F, 0x3C, 0x03, 0x78,
+  0x01, 0x78, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0,
+  0x00, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x78, 0x01, 0x7C,
+  0x03, 0x3F, 0x0F, 0x1F, 0xFF, 0x0F, 0xFF, 0x03, 0xF8, 0x00, 0x01, 0xE0,
+  0x00, 0x3C, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0,
+  0x00, 0x78, 0x00, 0x0F, 0x01, 0xF9, 0xE1, 0xFF, 0xFC, 0x7F, 0xFF, 0x9F,
+  0x83, 0xF3, 0xC0, 0x1E, 0xF0, 0x03, 0xDE, 0x00, 0x7F, 0x80, 0x0F, 0xF0,
+  0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0,
+  0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0x78, 0x01, 0xEF, 0x80, 0xFC, 0xF8,
+  0x3F, 0x8F, 0xFF, 0xF0, 0xFF, 0x9E, 0x0F, 0xC3, 0xC0, 0x01, 0xFC, 0x00,
+  0xFF, 0xE0, 0x7F, 0xFE, 0x1F, 0x03, 0xE3, 0xC0, 0x3C, 0xF0, 0x03, 0xDC,
+  0x00, 0x7F, 0x80, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+  0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3E, 0x00, 0x03, 0xC0, 0x00, 0x7C,
+  0x00, 0x27, 0xC0, 0x0C, 0xFC, 0x0F, 0x8F, 0xFF, 0xF0, 0x7F, 0xFC, 0x03,
+  0xFC, 0x00, 0x03, 0xF8, 0x3F, 0xC3, 0xFE, 0x3E, 0x01, 0xE0, 0x1E, 0x00,
+  0xF0, 0x07, 0x80, 0x3C, 0x07, 0xFF, 0xBF, 0xFD, 0xFF, 0xE3, 0xC0, 0x1E,
+  0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0,
+  0x1E, 0x00, 0xF0, 0x07, 0x80, 0x3C, 0x01, 0xE0, 0x0F, 0x00, 0x78, 0x03,
+  0xC0, 0x1E, 0x00, 0x01, 0xF8, 0x00, 0xFF, 0xFC, 0x7F, 0xFF, 0x9F, 0x83,
+  0xF3, 0xC0, 0x1E, 0xF0, 0x03, 0xDE, 0x00, 0x7F, 0x80, 0x0F, 0xF0, 0x01,
+  0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F, 0xE0, 0x03,
+  0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0x78, 0x01, 0xEF, 0x80, 0x7C, 0xF8, 0x3F,
+  0x9F, 0xFF, 0xF0, 0xFF, 0xDE, 0x0F, 0xE3, 0xC0, 0x00, 0x78, 0x00, 0x0F,
+  0x00, 0x03, 0xC4, 0x00, 0x78, 0xF0, 0x3E, 0x1F, 0xFF, 0x83, 0xFF, 0xE0,
+  0x1F, 0xF0, 0x00, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00, 0x1E, 0x00, 0x0F,
+  0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0, 0xF8, 0x79, 0xFF,
+  0x3D, 0xFF, 0xDF, 0xC3, 0xEF, 0x80, 0xFF, 0x80, 0x3F, 0xC0, 0x1F, 0xE0,
+  0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F,
+  0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01,
+  0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3C, 0xFF, 0xFF, 0x00, 0x0F, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0, 0xF0,
+  0x3C, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x1F, 0xC7, 0xF0, 0x3C, 0x0F,
+  0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0,
+  0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0, 0x3C,
+  0x1F, 0x0F, 0xBF, 0xEF, 0xF3, 0xF0, 0xF0, 0x00, 0x78, 0x00, 0x3C, 0x00,
+  0x1E, 0x00, 0x0F, 0x00, 0x07, 0x80, 0x03, 0xC0, 0x01, 0xE0, 0x00, 0xF0,
+  0x00, 0x78, 0x1F, 0xBC, 0x1F, 0x9E, 0x0F, 0x8F, 0x0F, 0x87, 0x8F, 0x83,
+  0xCF, 0x81, 0xEF, 0x80, 0xFF, 0x80, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xF0,
+  0x0F, 0xFC, 0x07, 0x9F, 0x03, 0xC7, 0x81, 0xE3, 0xE0, 0xF0, 0xF8, 0x78,
+  0x3E, 0x3C, 0x1F, 0x1E, 0x07, 0xCF, 0x01, 0xF7, 0x80, 0x7C, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xFF, 0x01, 0xF0, 0x1F, 0x0F, 0x3F, 0xC3, 0xFC, 0xFF, 0xFE, 0xFF, 0xEF,
+  0xE1, 0xFE, 0x1E, 0xF8, 0x1F, 0x81, 0xFF, 0x00, 0xF0, 0x0F, 0xF0, 0x0F,
+  0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F,
+  0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0x00, 0xFF, 0x00,
+  0xF0, 0x0F, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0x00,
+  0xFF, 0x00, 0xF0, 0x0F, 0xF0, 0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0xF0,
+  0x0F, 0x00, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0xF8, 0x79, 0xFF, 0x3D, 0xFF,
+  0xDF, 0xC3, 0xEF, 0x80, 0xFF, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF0,
+  0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F,
+  0xC0, 0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00,
+  0xFF, 0x00, 0x7F, 0x80, 0x3C, 0x03, 0xF8, 0x01, 0xFF, 0xC0, 0x7F, 0xFC,
+  0x1F, 0x07, 0xC7, 0xC0, 0x7C, 0xF0, 0x07, 0x9E, 0x00, 0xF7, 0x80, 0x0F,
+  0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00, 0x1F,
+  0xE0, 0x03, 0xFC, 0x00, 0x7B, 0xC0, 0x1E, 0x78, 0x03, 0xCF, 0x80, 0xF8,
+  0xF8, 0x3E, 0x0F, 0xFF, 0x80, 0xFF, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0xF8,
+  0x3C, 0xFF, 0x8F, 0xFF, 0xF3, 0xF8, 0x7C, 0xF8, 0x07, 0xBC, 0x01, 0xEF,
+  0x00, 0x7F, 0xC0, 0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0,
+  0x0F, 0xF0, 0x03, 0xFC, 0x00, 0xFF, 0x00, 0x3F, 0xC0, 0x1E, 0xF0, 0x07,
+  0xBC, 0x03, 0xCF, 0xC1, 0xF3, 0xFF, 0xF8, 0xFF, 0xFC, 0x3C, 0xFC, 0x0F,
+  0x00, 0x03, 0xC0, 0x00, 0xF0, 0x00, 0x3C, 0x00, 0x0F, 0x00, 0x03, 0xC0,
+  0x00, 0xF0, 0x00, 0x3C, 0x00, 0x00, 0x03, 0xF8, 0x01, 0xFF, 0xFC, 0x7F,
+  0xFF, 0x9F, 0x83, 0xF3, 0xC0, 0x1E, 0xF0, 0x03, 0xDE, 0x00, 0x7F, 0x80,
+  0x0F, 0xF0, 0x01, 0xFE, 0x00, 0x3F, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0x00,
+  0x1F, 0xE0, 0x03, 0xFC, 0x00, 0x7F, 0xC0, 0x0F, 0x78, 0x01, 0xEF, 0x80,
+  0x7C, 0xF8, 0x3F, 0x8F, 0xFF, 0xF0, 0xFF, 0xDE, 0x0F, 0xE3, 0xC0, 0x00,
+  0x78, 0x00, 0x0F, 0x00, 0x01, 0xE0, 0x00, 0x3C, 0x00, 0x07, 0x80, 0x00,
+  0xF0, 0x00, 0x1E, 0x00, 0x03, 0xC0, 0xF0, 0xFE, 0x7F, 0xDF, 0xFF, 0xFF,
+  0xE1, 0xF0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x01,
+  0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0, 0x78, 0x0F, 0x00, 0x0F,
+  0xE0, 0x3F, 0xF9, 0xFF, 0xF3, 0xE0, 0xEF, 0x00, 0x5E, 0x00, 0x3C, 0x00,
+  0x78, 0x00, 0xF8, 0x00, 0xFF, 0x01, 0xFF, 0xC1, 0xFF, 0xE0, 0xFF, 0xC0,
+  0x1F, 0xC0, 0x0F, 0x80, 0x0F, 0x80, 0x1F, 0x80, 0x3F, 0xC1, 0xF7, 0xFF,
+  0xE7, 0xFF, 0x03, 0xF8, 0x00, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C,
+  0x03, 0xC0, 0x3C, 0x03, 0xE1, 0x1F, 0xF0, 0xFF, 0x07, 0xE0, 0xF0, 0x07,
+  0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF, 0x00, 0x7F, 0x80, 0x3F, 0xC0,
+  0x1F, 0xE0, 0x0F, 0xF0, 0x07, 0xF8, 0x03, 0xFC, 0x01, 0xFE, 0x00, 0xFF,
+  0x00, 0x7F, 0x80, 0x3F, 0xC0, 0x1F, 0xE0, 0x0F, 0xF8, 0x1F, 0xBE, 0x1F,
+  0xDF, 0xFD, 0xE7, 0xFC, 0xF0, 0xF8, 0x78, 0xF0, 0x01, 0xEF, 0x00, 0x79,
+  0xE0, 0x0F, 0x3E, 0x03, 0xE3, 0xC0, 0x78, 0x78, 0x0F, 0x0F, 0x83, 0xE0,
+  0xF0, 0x78, 0x1E, 0x0F, 0x01, 0xE3, 0xC0, 0x3C, 0x78, 0x07, 0x8F, 0x00,
+  0x7B, 0xC0, 0x0F, 0x78, 0x01, 0xEF, 0x00, 0x1F, 0xC0, 0x03, 0xF8, 0x00,
+  0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF8, 0x00, 0x0E, 0x00, 0xF0, 0x0E, 0x01,
+  0xFE, 0x01, 0xC0, 0x3D, 0xE0, 0x7C, 0x0F, 0x3C, 0x0F, 0x81, 0xE7, 0x81,
+  0xF0, 0x3C, 0xF0, 0x37, 0x07, 0x8E, 0x0E, 0xE0, 0xE1, 0xE1, 0xDC, 0x1C,
+  0x3C, 0x31, 0xC7, 0x87, 0x8E, 0x38, 0xF0, 0x71, 0xC7, 0x1C, 0x0E, 0x30,
+  0x73, 0x81, 0xEE, 0x0E, 0x70, 0x3D, 0xC1, 0xCE, 0x03, 0xB8, 0x1F, 0x80,
+  0x7E, 0x03, 0xF0, 0x0F, 0xC0, 0x7E, 0x01, 0xF8, 0x0F, 0xC0, 0x1E, 0x00,
+  0xF0, 0x03, 0xC0, 0x1E, 0x00, 0x78, 0x03, 0xC0, 0xF8, 0x03, 0xEF, 0x80,
+  0xF8, 0xF0, 0x1E, 0x1F, 0x07, 0xC1, 0xF1, 0xF0, 0x1E, 0x3C, 0x03, 0xEF,
+  0x80, 0x3F, 0xE0, 0x03, 0xF8, 0x00, 0x7F, 0x00, 0x07, 0xC0, 0x01, 0xFC,
+  0x00, 0x3F, 0x80, 0x0F, 0xF8, 0x03, 0xEF, 0x80, 0x78, 0xF0, 0x1F, 0x1F,
+  0x07, 0xC1, 0xF0, 0xF0, 0x1E, 0x3E, 0x03, 0xEF, 0x80, 0x3E, 0xF0, 0x01,
+  0xEF, 0x00, 0x79, 0xE0, 0x0F, 0x3E, 0x03, 0xE3, 0xC0, 0x78, 0x78, 0x0F,
+  0x0F, 0x83, 0xC0, 0xF0, 0x78, 0x1E, 0x0F, 0x01, 0xE3, 0xC0, 0x3C, 0x78,
+  0x07, 0xCF, 0x00, 0x7B, 0xC0, 0x0F, 0x78, 0x00, 0xFE, 0x00, 0x1F, 0xC0,
+  0x03, 0xF8, 0x00, 0x3E, 0x00, 0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00,
+  0x07, 0xC0, 0x00, 0xF0, 0x00, 0x1E, 0x00, 0x07, 0x80, 0x00, 0xF0, 0x00,
+  0x3E, 0x00, 0x07, 0x80, 0x01, 0xF0, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+  0xF8, 0x01, 0xE0, 0x07, 0xC0, 0x1F, 0x00, 0x3C, 0x00, 0xF8, 0x03, 0xE0,
+  0x07, 0x80, 0x1F, 0x00, 0x7C, 0x00, 0xF8, 0x03, 0xE0, 0x0F, 0x80, 0x1F,
+  0x00, 0x7C, 0x00, 0xF0, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00,
+  0x3E, 0x01, 0xFC, 0x07, 0xF8, 0x0F, 0x00, 0x3C, 0x00, 0x70, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00,
+  0x70, 0x01, 0xC0, 0x07, 0x80, 0x1E, 0x01, 0xF8, 0x03, 0xE0, 0x07, 0xE0,
+  0x01, 0xE0, 0x01, 0xE0, 0x01, 0xC0, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x03,
+  0xC0, 0x03, 0xC0, 0x07, 0xF8, 0x07, 0xF0, 0x03, 0xE0, 0xFF, 0xFF, 0xFF,
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xF8,
+  0x01, 0xFC, 0x03, 0xFC, 0x00, 0x78, 0x00, 0x78, 0x00, 0x70, 0x00, 0xE0,
+  0x01, 0xC0, 0x03, 0x80, 0x07, 0x00, 0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00,
+  0x70, 0x00, 0x70, 0x00, 0xE0, 0x00, 0xF0, 0x00, 0xFC, 0x00, 0x78, 0x03,
+  0xF0, 0x0F, 0x00, 0x38, 0x00, 0x70, 0x01, 0xC0, 0x03, 0x80, 0x07, 0x00,
+  0x0E, 0x00, 0x1C, 0x00, 0x38, 0x00, 0x70, 0x00, 0xE0, 0x01, 0xC0, 0x07,
+  0x80, 0x1E, 0x03, 0xFC, 0x07, 0xF0, 0x0F, 0x80, 0x00, 0x0F, 0x80, 0x1C,
+  0x7F, 0x00, 0x73, 0xFE, 0x01, 0xDE, 0x3C, 0x07, 0x70, 0x78, 0x39, 0xC1,
+  0xE0, 0xEE, 0x03, 0xC7, 0xB8, 0x07, 0xFC, 0xE0, 0x0F, 0xE3, 0x80, 0x0F,
+  0x00 };
+
+constexpr GFXglyph tahoma20pt7bGlyphs[] PROGMEM = {
+  {     0,   1,   1,  12,    0,    0 },   // 0x20 ' '
+  {     1,   4,  28,  13,    5,  -27 },   // 0x21 '!'
+  {    15,  11,  11,  16,    2,  -29 },   // 0x22 '"'
+  {    31,  23,  28,  28,    2,  -27 },   // 0x23 '#'
+  {   112,  17,  37,  21,    2,  -29 },   // 0x24 '$'
+  {   191,  34,  29,  38,    2,  -28 },   // 0x25 '%'
+  {   315,  26,  29,  26,    1,  -28 },   // 0x26 '&'
+  {   410,   4,  11,   8,    2,  -29 },   // 0x27 '''
+  {   416,  11,  38,  15,    2,  -29 },   // 0x28 '('
+  {   469,  11,  38,  15,    2,  -29 },   // 0x29 ')'
+  {   522,  17,  18,  21,    2,  -29 },   // 0x2A '*'
+  {   561,  23,  23,  28,    3,  -23 },   // 0x2B '+'
+  {   628,   8,  12,  12,    1,   -4 },   // 0x2C ','
+  {   640,  11,   3,  14,    2,  -13 },   // 0x2D '-'
+  {   645,   5,   5,  12,    4,   -4 },   // 0x2E '.'
+  {   649,  14,  36,  15,    0,  -29 },   // 0x2F '/'
+  {   712,  18,  29,  21,    2,  -28 },   // 0x30 '0'
+  {   778,  14,  28,  21,    4,  -27 },   // 0x31 '1'
+  {   827,  17,  29,  21,    2,  -28 },   // 0x32 '2'
+  {   889,  17,  29,  21,    2,  -28 },   // 0x33 '3'
+  {   951,  19,  28,  21,    1,  -27 },   // 0x34 '4'
+  {  1018,  17,  28,  21,    2,  -27 },   // 0x35 '5'
+  {  1078,  18,  29,  21,    2,  -28 },   // 0x36 '6'
+  {  1144,  18,  28,  21,    2,  -27 },   // 0x37 '7'
+  {  1207,  18,  29,  21,    1,  -28 },   // 0x38 '8'
+  {  1273,  18,  29,  21,    1,  -28 },   // 0x39 '9'
+  {  1339,   5,  21,  14,    5,  -20 },   // 0x3A ':'
+  {  1353,   8,  28,  14,    3,  -20 },   // 0x3B ';'
+  {  1381,  20,  21,  28,    4,  -22 },   // 0x3C '<'
+  {  1434,  21,  11,  28,    4,  -17 },   // 0x3D '='
+  {  1463,  20,  21,  28,    4,  -22 },   // 0x3E '>'
+  {  1516,  15,  29,  18,    2,  -28 },   // 0x3F '?'
+  {  1571,  30,  33,  35,    3,  -28 },   // 0x40 '@'
+  {  1695,  23,  28,  23,    0,  -27 },   // 0x41 'A'
+  {  1776,  19,  28,  23,    3,  -27 },   // 0x42 'B'
+  {  1843,  21,  29,  23,    1,  -28 },   // 0x43 'C'
+  {  1920,  22,  28,  26,    3,  -27 },   // 0x44 'D'
+  {  1997,  18,  28,  22,    3,  -27 },   // 0x45 'E'
+  {  2060,  17,  28,  20,    3,  -27 },   // 0x46 'F'
+  {  2120,  23,  29,  26,    1,  -28 },   // 0x47 'G'
+  {  2204,  20,  28,  26,    3,  -27 },   // 0x48 'H'
+  {  2274,  12,  28,  15,    2,  -27 },   // 0x49 'I'
+  {  2316,  13,  28,  16,    0,  -27 },   // 0x4A 'J'
+  {  2362,  21,  28,  23,    3,  -27 },   // 0x4B 'K'
+  {  2436,  16,  28,  19,    3,  -27 },   // 0x4C 'L'
+  {  2492,  24,  28,  30,    3,  -27 },   // 0x4D 'M'
+  {  2576,  20,  28,  26,    3,  -27 },   // 0x4E 'N'
+  {  2646,  26,  29,  28,    1,  -28 },   // 0x4F 'O'
+  {  2741,  18,  28,  22,    3,  -27 },   // 0x50 'P'
+  {  2804,  26,  36,  28,    1,  -28 },   // 0x51 'Q'
+  {  2921,  22,  28,  24,    3,  -27 },   // 0x52 'R'
+  {  2998,  19,  29,  22,    2,  -28 },   // 0x53 'S'
+  {  3067,  24,  28,  23,    0,  -27 },   // 0x54 'T'
+  {  3151,  20,  28,  26,    3,  -27 },   // 0x55 'U'
+  {  3221,  23,  28,  23,    0,  -27 },   // 0x56 'V'
+  {  3302,  34,  28,  35,    1,  -27 },   // 0x57 'W'
+  {  3421,  23,  28,  23,    0,  -27 },   // 0x58 'X'
+  {  3502,  24,  28,  22,   -1,  -27 },   // 0x59 'Y'
+  {  3586,  20,  28,  22,    1,  -27 },   // 0x5A 'Z'
+  {  3656,  10,  37,  15,    3,  -29 },   // 0x5B '['
+  {  3703,  14,  36,  15,    1,  -29 },   // 0x5C '\'
+  {  3766,  10,  37,  15,    2,  -29 },   // 0x5D ']'
+  {  3813,  23,  15,  28,    3,  -27 },   // 0x5E '^'
+  {  3857,  21,   2,  21,    0,    4 },   // 0x5F '_'
+  {  3863,   8,   7,  21,    5,  -31 },   // 0x60 '`'
+  {  3870,  17,  22,  20,    1,  -21 },   // 0x61 'a'
+  {  3917,  18,  30,  22,    3,  -29 },   // 0x62 'b'
+  {  3985,  16,  22,  18,    1,  -21 },   // 0x63 'c'
+  {  4029,  19,  30,  22,    1,  -29 },   // 0x64 'd'
+  {  4101,  19,  22,  21,    1,  -21 },   // 0x65 'e'
+  {  4154,  13,  30,  12,    1,  -29 },   // 0x66 'f'
+  {  4203,  19,  30,  22,    1,  -21 },   // 0x67 'g'
+  {  4275,  17,  30,  22,    3,  -29 },   // 0x68 'h'
+  {  4339,   4,  28,   9,    3,  -27 },   // 0x69 'i'
+  {  4353,  10,  36,  11,   -1,  -27 },   // 0x6A 'j'
+  {  4398,  17,  30,  19,    3,  -29 },   // 0x6B 'k'
+  {  4462,   4,  30,   9,    3,  -29 },   // 0x6C 'l'
+  {  4477,  28,  22,  33,    3,  -21 },   // 0x6D 'm'
+  {  4554,  17,  22,  22,    3,  -21 },   // 0x6E 'n'
+  {  4601,  19,  22,  21,    1,  -21 },   // 0x6F 'o'
+  {  4654,  18,  30,  22,    3,  -21 },   // 0x70 'p'
+  {  4722,  19,  30,  22,    1,  -21 },   // 0x71 'q'
+  {  4794,  11,  21,  14,    3,  -20 },   // 0x72 'r'
+  {  4823,  15,  22,  17,    1,  -21 },   // 0x73 's'
+  {  4865,  12,  27,  13,    1,  -26 },   // 0x74 't'
+  {  4906,  17,  21,  22,    3,  -20 },   // 0x75 'u'
+  {  4951,  19,  21,  19,    0,  -20 },   // 0x76 'v'
+  {  5001,  27,  21,  29,    1,  -20 },   // 0x77 'w'
+  {  5072,  19,  21,  19,    0,  -20 },   // 0x78 'x'
+  {  5122,  19,  29,  19,    0,  -20 },   // 0x79 'y'
+  {  5191,  15,  21,  17,    1,  -20 },   // 0x7A 'z'
+  {  5231,  15,  37,  19,    1,  -29 },   // 0x7B '{'
+  {  5301,   3,  37,  15,    6,  -29 },   // 0x7C '|'
+  {  5315,  15,  37,  19,    3,  -29 },   // 0x7D '}'
+  {  5385,  22,  10,  28,    3,  -17 } }; // 0x7E '~'
+
+constexpr GFXfont tahoma20pt7b PROGMEM = {
+  (uint8_t  *)tahoma20pt7bBitmaps,
+  (GFXglyph *)tahoma20pt7bGlyphs,
+  0x20, 0x7E, 47 };
+
+// Approx. 6085 bytes
@@ -33,7 +33,7 @@ const uint8_t tahoma5pt7bBitmaps[] PROGMEM = {
   0x8A, 0x94, 0xA2, 0x11, 0x00, 0xE5, 0x4E, 0x12, 0x22, 0x2C, 0x22, 0x21,
   0xFF, 0xC0, 0x84, 0x44, 0x43, 0x44, 0x48, 0x46, 0xD8, 0x80 };
 
-const GFXglyph tahoma5pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph tahoma5pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,   3,    0,    0 },   // 0x20 ' '
   {     1,   1,   7,   2,    0,   -6 },   // 0x21 '!'
   {     2,   3,   3,   4,    0,   -7 },   // 0x22 '"'
@@ -130,7 +130,7 @@ const GFXglyph tahoma5pt7bGlyphs[] PROGMEM = {
   {   386,   4,  10,   5,    0,   -7 },   // 0x7D '}'
   {   391,   6,   3,   7,    0,   -4 } }; // 0x7E '~'
 
-const GFXfont tahoma5pt7b PROGMEM = {
+constexpr GFXfont tahoma5pt7b PROGMEM = {
   (uint8_t  *)tahoma5pt7bBitmaps,
   (GFXglyph *)tahoma5pt7bGlyphs,
   0x20, 0x7E, 12 };
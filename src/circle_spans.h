@@ -0,0 +1,144 @@
+// Filled and outlined circles written into the 1bpp panel buffer a row at a time.
+//
+// Adafruit_GFX::fillCircle() is a fan of vertical lines and drawCircle() eight
+// mirrored pixels per step, all through the display's virtual drawPixel().
+// Here the compiler works out, per radius, which columns each row of the
+// circle covers, and drawing writes those runs into the buffer as whole bytes
+// with masked ends:
+//
+//   CircleSpans<R>::fill[dy]          half width of the disc row dy above/below
+//                                     the centre, as fillCircle(r) fills it
+//   CircleSpans<R>::outlineLo/Hi[dy]  |dx| range of the drawCircle(r) pixels
+//                                     on that row (one run each side)
+//
+// Pixels match the GFX calls exactly, including clipping at the screen edges
+// (tools/circle_spans_check.cpp). Same buffer assumptions as digits.h:
+// rotation 0, row-major, MSB = leftmost pixel.
+
+#ifndef CIRCLE_SPANS_H
+#define CIRCLE_SPANS_H
+
+#include <stdint.h>
+#include <string.h>
+#include "ring_geometry.h"
+
+constexpr int circleMax(int a, int b) {
+  return a > b ? a : b;
+}
+
+constexpr int circleMin(int a, int b) {
+  return a < b ? a : b;
+}
+
+// fillCircleHelper() walk for one column: the longest vertical line it draws there.
+// x, y are the values after a step; px, py its bookkeeping of the previous ones.
+constexpr int circleFillWalk(int col, int x, int y, int f, int ddFy, int px, int py, int best);
+
+constexpr int circleFillAfter(int col, int x, int y, int f, int ddFy, int px, int py, int best) {
+  return circleFillWalk(col, x, y, f, ddFy, x, y != py ? y : py,
+                        circleMax(best, circleMax(x < y + 1 && x == col ? y : -1,
+                                                  y != py && py == col ? px : -1)));
+}
+
+constexpr int circleFillWalk(int col, int x, int y, int f, int ddFy, int px, int py, int best) {
+  return x >= y ? best
+       : f >= 0 ? circleFillAfter(col, x + 1, y - 1, f + ddFy + 2 + 2 * x + 3, ddFy + 2, px, py, best)
+                : circleFillAfter(col, x + 1, y, f + 2 * x + 3, ddFy, px, py, best);
+}
+
+// Half height of column dx of fillCircle(r), -1 if it draws nothing there
+constexpr int circleFillColumn(int radius, int col) {
+  return circleFillWalk(col, 0, radius, 1 - radius, -2 * radius, 0, radius, col == 0 ? radius : -1);
+}
+
+// Widest column reaching row dy; the disc's columns shrink outwards, so that is the half width
+constexpr int circleFillRow(int radius, int dy, int col) {
+  return col < 0 ? -1 : circleFillColumn(radius, col) >= dy ? col : circleFillRow(radius, dy, col - 1);
+}
+
+// drawCircle() pixels on row dy: the run of octant points at height dy plus the mirrored point (dy, octant[dy])
+constexpr int circleOctant(int radius, int x) {
+  return circleOctantY(0, radius, 1 - radius, -2 * radius, x);
+}
+
+constexpr int circleOctantLast(int radius) {
+  return circleOctantEnd(0, radius, 1 - radius, -2 * radius);
+}
+
+constexpr int circleOutlineLo(int radius, int dy, int x) {
+  return x > circleOctantLast(radius) ? (dy <= circleOctantLast(radius) ? circleOctant(radius, dy) : radius)
+       : circleOctant(radius, x) == dy
+           ? (dy <= circleOctantLast(radius) ? circleMin(x, circleOctant(radius, dy)) : x)
+           : circleOutlineLo(radius, dy, x + 1);
+}
+
+constexpr int circleOutlineHi(int radius, int dy, int x) {
+  return x < 0 ? (dy <= circleOctantLast(radius) ? circleOctant(radius, dy) : 0)
+       : circleOctant(radius, x) == dy
+           ? (dy <= circleOctantLast(radius) ? circleMax(x, circleOctant(radius, dy)) : x)
+           : circleOutlineHi(radius, dy, x - 1);
+}
+
+template <int Radius, class S> struct CircleSpanTable;
+template <int Radius, int... I> struct CircleSpanTable<Radius, TrigSeq<I...> > {
+  static constexpr int8_t fill[sizeof...(I)] = { (int8_t)circleFillRow(Radius, I, Radius)... };
+  static constexpr int8_t outlineLo[sizeof...(I)] = { (int8_t)circleOutlineLo(Radius, I, 0)... };
+  static constexpr int8_t outlineHi[sizeof...(I)] = { (int8_t)circleOutlineHi(Radius, I, circleOctantLast(Radius))... };
+};
+template <int Radius, int... I>
+constexpr int8_t CircleSpanTable<Radius, TrigSeq<I...> >::fill[sizeof...(I)];
+template <int Radius, int... I>
+constexpr int8_t CircleSpanTable<Radius, TrigSeq<I...> >::outlineLo[sizeof...(I)];
+template <int Radius, int... I>
+constexpr int8_t CircleSpanTable<Radius, TrigSeq<I...> >::outlineHi[sizeof...(I)];
+
+template <int Radius>
+struct CircleSpans : CircleSpanTable<Radius, typename TrigMakeSeq<Radius + 1>::type> {
+  static_assert(Radius > 0 && Radius < 128, "span tables hold int8 offsets");
+};
+
+// Set (bit = 1) or clear pixels x0..x1 of row y, clipped to the buffer
+inline void spanWrite(uint8_t *buffer, int width, int height, int y, int x0, int x1, bool bit) {
+  if (y < 0 || y >= height) return;
+  if (x0 < 0) x0 = 0;
+  if (x1 >= width) x1 = width - 1;
+  if (x1 < x0) return;
+
+  uint8_t *row = buffer + y * (width / 8);
+  int b0 = x0 >> 3;
+  int b1 = x1 >> 3;
+  uint8_t first = 0xFF >> (x0 & 7);
+  uint8_t last = 0xFF << (7 - (x1 & 7));
+  if (b0 == b1) {
+    first &= last;
+    if (bit) row[b0] |= first; else row[b0] &= ~first;
+    return;
+  }
+  if (bit) row[b0] |= first; else row[b0] &= ~first;
+  memset(row + b0 + 1, bit ? 0xFF : 0x00, b1 - b0 - 1);
+  if (bit) row[b1] |= last; else row[b1] &= ~last;
+}
+
+// fillCircle(cx, cy, radius) from its half-width table
+inline void circleFillSpans(uint8_t *buffer, int width, int height, int cx, int cy,
+                            const int8_t *fill, int radius, bool bit) {
+  spanWrite(buffer, width, height, cy, cx - fill[0], cx + fill[0], bit);
+  for (int dy = 1; dy <= radius; dy++) {
+    spanWrite(buffer, width, height, cy - dy, cx - fill[dy], cx + fill[dy], bit);
+    spanWrite(buffer, width, height, cy + dy, cx - fill[dy], cx + fill[dy], bit);
+  }
+}
+
+// drawCircle(cx, cy, radius) from its outline tables
+inline void circleOutlineSpans(uint8_t *buffer, int width, int height, int cx, int cy,
+                               const int8_t *lo, const int8_t *hi, int radius, bool bit) {
+  for (int dy = 0; dy <= radius; dy++) {
+    spanWrite(buffer, width, height, cy - dy, cx - hi[dy], cx - lo[dy], bit);
+    spanWrite(buffer, width, height, cy - dy, cx + lo[dy], cx + hi[dy], bit);
+    if (dy == 0) continue;
+    spanWrite(buffer, width, height, cy + dy, cx - hi[dy], cx - lo[dy], bit);
+    spanWrite(buffer, width, height, cy + dy, cx + lo[dy], cx + hi[dy], bit);
+  }
+}
+
+#endif // CIRCLE_SPANS_H
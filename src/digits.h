@@ -0,0 +1,159 @@
+// Fast renderer for the large numeric readouts (distance, speed).
+//
+// Adafruit_GFX draws a glyph one writePixel() per set bit, through the
+// display's virtual drawPixel(). The readouts only use a handful of
+// characters, so at boot those glyphs are unpacked from the GFXfont bit
+// stream into row-aligned 1bpp bitmaps, and a string is drawn by shifting
+// each glyph row into place and OR-ing it (or AND-ing, depending on the
+// panel buffer's polarity) straight into the framebuffer.
+//
+// Output matches display.print() with the same font and cursor: glyph
+// placement, transparent background, clipping at the screen edges
+// (tools/digits_check.cpp). GFX text wrapping is not reproduced; the
+// readouts are centred and never reach the right edge.
+//
+// Assumes rotation 0 and the GxEPD buffer layout (row-major, MSB = leftmost).
+
+#ifndef DIGITS_H
+#define DIGITS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define DIGIT_CHARS " -.0123456789m"
+#define DIGIT_GLYPHS 14
+#define DIGIT_BITS_SIZE 1024   // Row-aligned bitmaps for all glyphs, tahoma20 needs 930 bytes
+
+struct DigitGlyph {
+  uint16_t offset;    // Into DigitFont::bits
+  uint8_t width;
+  uint8_t height;
+  uint8_t stride;     // Bytes per row
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+};
+
+struct DigitFont {
+  DigitGlyph glyph[DIGIT_GLYPHS];
+  uint8_t bits[DIGIT_BITS_SIZE];   // Set bit = ink
+  bool ready;
+};
+
+// Glyph cells covered by the last digitsDraw(), inclusive, screen-clipped; empty when x1 < x0
+struct DigitBox {
+  int16_t x0, y0, x1, y1;
+};
+
+inline int digitIndex(char c) {
+  const char *p = c ? strchr(DIGIT_CHARS, c) : nullptr;
+  return p ? (int)(p - DIGIT_CHARS) : -1;
+}
+
+inline bool digitsCanDraw(const DigitFont &font, const char *s) {
+  if (!font.ready) return false;
+  for (; *s; s++) {
+    if (digitIndex(*s) < 0) return false;
+  }
+  return true;
+}
+
+// Unpack the readout glyphs of a GFXfont into row-aligned bitmaps. False if
+// the font lacks one of them or they don't fit; callers then keep using print().
+inline bool digitFontBuild(DigitFont &out, const GFXfont *font) {
+  out.ready = false;
+  uint16_t used = 0;
+  memset(out.bits, 0, sizeof(out.bits));
+
+  for (int i = 0; i < DIGIT_GLYPHS; i++) {
+    uint8_t c = DIGIT_CHARS[i];
+    if (c < font->first || c > font->last) return false;
+    const GFXglyph &g = font->glyph[c - font->first];
+
+    DigitGlyph &d = out.glyph[i];
+    d.offset = used;
+    d.width = g.width;
+    d.height = g.height;
+    d.stride = (g.width + 7) / 8;
+    d.xAdvance = g.xAdvance;
+    d.xOffset = g.xOffset;
+    d.yOffset = g.yOffset;
+    if (used + d.stride * d.height > DIGIT_BITS_SIZE) return false;
+
+    // GFX glyph bitmaps are one continuous bit stream, rows not byte-aligned
+    const uint8_t *src = font->bitmap + g.bitmapOffset;
+    uint32_t bit = 0;
+    for (int y = 0; y < g.height; y++) {
+      uint8_t *row = out.bits + used + y * d.stride;
+      for (int x = 0; x < g.width; x++, bit++) {
+        if (src[bit >> 3] & (0x80 >> (bit & 7))) {
+          row[x >> 3] |= 0x80 >> (x & 7);
+        }
+      }
+    }
+    used += d.stride * d.height;
+  }
+  out.ready = true;
+  return true;
+}
+
+// Draw s with its baseline at cursor (x, y) into a width x height 1bpp buffer.
+// Ink pixels become black (bit value blackBit); everything else is untouched.
+// Returns the cursor x after the string, like print() leaves it.
+inline int digitsDraw(uint8_t *buffer, int width, int height, const DigitFont &font,
+                      int x, int y, const char *s, bool blackBit, DigitBox &box) {
+  const int bufferStride = width / 8;
+  box.x0 = box.y0 = 0;
+  box.x1 = box.y1 = -1;
+
+  for (; *s; s++) {
+    const DigitGlyph &g = font.glyph[digitIndex(*s)];
+    const uint8_t *src = font.bits + g.offset;
+    int gx = x + g.xOffset;
+    int gy = y + g.yOffset;
+
+    for (int row = 0; row < g.height; row++, src += g.stride) {
+      int py = gy + row;
+      if (py < 0 || py >= height) continue;
+      uint8_t *dst = buffer + py * bufferStride;
+
+      for (int b = 0; b < g.stride; b++) {
+        uint8_t ink = src[b];
+        if (!ink) continue;
+        int px = gx + b * 8;              // Screen x of this byte's first pixel
+        int shift = px & 7;
+        int col = px >> 3;                // Arithmetic shift: floor for negative x
+
+        // The byte spans at most two destination bytes
+        uint8_t lo = ink >> shift;
+        uint8_t hi = shift ? (uint8_t)(ink << (8 - shift)) : 0;
+        if (col >= 0 && col < bufferStride && lo) {
+          if (blackBit) dst[col] |= lo; else dst[col] &= ~lo;
+        }
+        if (col + 1 >= 0 && col + 1 < bufferStride && hi) {
+          if (blackBit) dst[col + 1] |= hi; else dst[col + 1] &= ~hi;
+        }
+      }
+    }
+
+    // Box covers the glyph cell, clipped to the screen
+    int x0 = gx < 0 ? 0 : gx;
+    int x1 = gx + g.width - 1 < width ? gx + g.width - 1 : width - 1;
+    int y0 = gy < 0 ? 0 : gy;
+    int y1 = gy + g.height - 1 < height ? gy + g.height - 1 : height - 1;
+    if (x1 >= x0 && y1 >= y0) {
+      if (box.x1 < box.x0) {
+        box.x0 = x0; box.y0 = y0; box.x1 = x1; box.y1 = y1;
+      } else {
+        if (x0 < box.x0) box.x0 = x0;
+        if (y0 < box.y0) box.y0 = y0;
+        if (x1 > box.x1) box.x1 = x1;
+        if (y1 > box.y1) box.y1 = y1;
+      }
+    }
+    x += g.xAdvance;
+  }
+  return x;
+}
+
+#endif // DIGITS_H
@@ -0,0 +1,32 @@
+// Direct access to the GxEPD panel buffer.
+//
+// GxDEPG0150BN keeps its 1bpp frame (200x200 / 8 = 5000 bytes) private and
+// only exposes drawPixel(). Whole-frame operations such as restoring the
+// cached background are a memcpy on the raw buffer, so this hands out a
+// pointer to it. Explicit template instantiation is exempt from access
+// checks, which lets us name the member without patching the library; if a
+// GxEPD update renames it, this fails to compile rather than misbehaving.
+
+#ifndef FRAMEBUFFER_H
+#define FRAMEBUFFER_H
+
+#include <stdint.h>
+#include <GxDEPG0150BN/GxDEPG0150BN.h>
+
+#define FRAME_BUFFER_SIZE GxDEPG0150BN_BUFFER_SIZE
+
+typedef uint8_t (GxDEPG0150BN::*FrameBufferMember)[FRAME_BUFFER_SIZE];
+
+template <FrameBufferMember Member>
+struct FrameBufferAccess {
+  friend FrameBufferMember frameBufferMember() { return Member; }
+};
+
+FrameBufferMember frameBufferMember();
+template struct FrameBufferAccess<&GxDEPG0150BN::_buffer>;
+
+inline uint8_t *frameBuffer(GxDEPG0150BN &panel) {
+  return panel.*frameBufferMember();
+}
+
+#endif // FRAMEBUFFER_H
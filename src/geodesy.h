@@ -0,0 +1,146 @@
+// Distance and bearing from the current position to navigation targets.
+//
+// Positions are int32 in 1e-7 degree units (the UBX NAV-PVT encoding, 1.1 cm
+// resolution). Differences are taken in integers, so they stay exact when
+// converted to float out to ~1.6 degrees, and everything after that runs on
+// the ESP32's single-precision FPU. No soft-float doubles are used per target.
+//
+// Short ranges use an equirectangular projection about the origin with the
+// cos(lat) scale cached per origin and corrected to the mid latitude of each
+// target. Beyond GEO_FAST_RANGE_M, or near the poles, it falls back to the
+// great-circle distance and course on the TinyGPSPlus sphere, evaluated in float.
+//
+// Error against TinyGPSPlus::distanceBetween / courseTo in double
+// (tools/geodesy_bench.cpp, origins between +-80 deg latitude):
+//   out to GEO_FAST_RANGE_M   distance < 0.3 m (0.002% of range), course < 0.001 deg
+//   fallback, 20-500 km       distance < 0.3 m (0.0003% of range), course < 0.001 deg
+// Storing positions as int32 adds at most 1.5 cm.
+
+#ifndef GEODESY_H
+#define GEODESY_H
+
+#include <math.h>
+#include <stdint.h>
+
+#define GEO_EARTH_RADIUS_M 6372795.0    // Same radius TinyGPSPlus uses
+#define GEO_FAST_RANGE_M 20000.0f       // Flat-earth path out to 20 km
+#define GEO_FAST_MAX_LAT_E7 800000000   // 80 deg - cos(lat) scale gets too steep above this
+#define GEO_E7 10000000.0
+#define GEO_DEG_TO_RAD 0.017453292519943295
+#define GEO_RAD_TO_DEG 57.29577951308232
+#define GEO_E7_TO_RAD ((float)(GEO_DEG_TO_RAD / GEO_E7))
+#define GEO_METRES_PER_E7 ((float)(GEO_EARTH_RADIUS_M * GEO_DEG_TO_RAD / GEO_E7))
+
+// Latitude/longitude in 1e-7 degrees
+struct GeoPoint {
+  int32_t lat;
+  int32_t lon;
+};
+
+inline int32_t geoToE7(double deg) {
+  return (int32_t)lround(deg * GEO_E7);
+}
+
+inline double geoFromE7(int32_t e7) {
+  return e7 / GEO_E7;
+}
+
+inline GeoPoint geoPoint(double lat, double lon) {
+  GeoPoint p = { geoToE7(lat), geoToE7(lon) };
+  return p;
+}
+
+// 0,0 marks an unset point throughout the firmware
+inline bool geoIsSet(const GeoPoint &p) {
+  return p.lat != 0 || p.lon != 0;
+}
+
+// Projection origin - set once per position, reused for every target
+struct GeoOrigin {
+  GeoPoint pos;
+  float cosLat;
+  float sinLat;
+  bool fast;             // Origin is within the flat-earth latitude band
+};
+
+inline void geoSetOrigin(GeoOrigin &origin, const GeoPoint &pos) {
+  origin.pos = pos;
+  float latRad = pos.lat * GEO_E7_TO_RAD;
+  origin.cosLat = cosf(latRad);
+  origin.sinLat = sinf(latRad);
+  origin.fast = pos.lat < GEO_FAST_MAX_LAT_E7 && pos.lat > -GEO_FAST_MAX_LAT_E7;
+}
+
+// Longitude difference b - a wrapped to +-180 deg
+inline int32_t geoDeltaLonE7(int32_t a, int32_t b) {
+  int64_t d = (int64_t)b - a;
+  if (d > 1800000000LL) d -= 3600000000LL;
+  else if (d < -1800000000LL) d += 3600000000LL;
+  return (int32_t)d;
+}
+
+// Great-circle distance (m) and initial course (deg). Same sphere as TinyGPSPlus, but written
+// in haversine form on the exact integer deltas so it stays accurate in float at short range.
+inline float geoGreatCircle(const GeoPoint &a, const GeoPoint &b, float *courseDeg) {
+  float dLat = (float)(b.lat - a.lat) * GEO_E7_TO_RAD;
+  float dLon = (float)geoDeltaLonE7(a.lon, b.lon) * GEO_E7_TO_RAD;
+  float phi1 = a.lat * GEO_E7_TO_RAD;
+  float phi2 = b.lat * GEO_E7_TO_RAD;
+  float s1 = sinf(phi1), c1 = cosf(phi1);
+  float c2 = cosf(phi2);
+  float sHalfLat = sinf(0.5f * dLat);
+  float sHalfLon = sinf(0.5f * dLon);
+
+  if (courseDeg) {
+    // cos(phi1)sin(phi2) - sin(phi1)cos(phi2)cos(dLon), rearranged to avoid cancellation
+    float north = sinf(dLat) + 2.0f * s1 * c2 * sHalfLon * sHalfLon;
+    float course = atan2f(sinf(dLon) * c2, north) * (float)GEO_RAD_TO_DEG;
+    if (course < 0.0f) course += 360.0f;
+    *courseDeg = course;
+  }
+
+  float h = sHalfLat * sHalfLat + c1 * c2 * sHalfLon * sHalfLon;
+  if (h > 1.0f) h = 1.0f;
+  return 2.0f * atan2f(sqrtf(h), sqrtf(1.0f - h)) * (float)GEO_EARTH_RADIUS_M;
+}
+
+// East/north offset (m) of a nearby point from the origin, flat-earth
+inline void geoLocal(const GeoOrigin &origin, const GeoPoint &target, float &x, float &y) {
+  float dLat = (float)(target.lat - origin.pos.lat);
+  float dLon = (float)geoDeltaLonE7(origin.pos.lon, target.lon);
+
+  // cos(mid latitude) to first order about the cached origin
+  float cosMid = origin.cosLat - origin.sinLat * (dLat * GEO_E7_TO_RAD * 0.5f);
+  x = dLon * GEO_METRES_PER_E7 * cosMid;
+  y = dLat * GEO_METRES_PER_E7;
+}
+
+// Distance (m) from the origin to a target, and optionally the course to it (deg, 0-360)
+inline float geoVector(const GeoOrigin &origin, const GeoPoint &target, float *courseDeg = nullptr) {
+  float x, y;
+  geoLocal(origin, target, x, y);
+  float distance = sqrtf(x * x + y * y);
+
+  if (!origin.fast || distance > GEO_FAST_RANGE_M) {
+    return geoGreatCircle(origin.pos, target, courseDeg);
+  }
+
+  if (courseDeg) {
+    // Chord direction, turned back by half the meridian convergence to give the initial course
+    float dLonDeg = geoDeltaLonE7(origin.pos.lon, target.lon) * (float)(1.0 / GEO_E7);
+    float course = atan2f(x, y) * (float)GEO_RAD_TO_DEG - 0.5f * dLonDeg * origin.sinLat;
+    if (course < 0.0f) course += 360.0f;
+    else if (course >= 360.0f) course -= 360.0f;
+    *courseDeg = course;
+  }
+  return distance;
+}
+
+// Distance (m) between two arbitrary points, e.g. route legs
+inline float geoDistance(const GeoPoint &a, const GeoPoint &b) {
+  GeoOrigin origin;
+  geoSetOrigin(origin, a);
+  return geoVector(origin, b);
+}
+
+#endif // GEODESY_H
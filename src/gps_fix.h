@@ -0,0 +1,68 @@
+// The navigation solution handed from the GPS decoders to the navigation code.
+//
+// Both wire protocols (NMEA via nmea.h, UBX NAV-PVT via ubx.h) fill the same
+// Fix, so everything downstream is protocol-agnostic. Plain C++ with no
+// Arduino dependencies, so host tools (tools/ubx_check.cpp, tools/nav_replay.cpp)
+// decode into the same struct the firmware uses.
+
+#ifndef GPS_FIX_H
+#define GPS_FIX_H
+
+#include <stdint.h>
+
+// One navigation solution, independent of the wire protocol it arrived in.
+// Published whole by gpsTask and never modified afterwards, so a frame can't mix two fixes.
+struct Fix {
+  uint32_t timestampMs;  // millis() when the solution was decoded
+  uint32_t seq;
+  uint32_t gpsTimeMs;    // Receiver time: UTC time of day (NMEA) or GPS time of week (UBX)
+  uint32_t utcEpoch;     // Unix time of the solution, 0 until date and time are valid
+  double lat;
+  double lon;
+  double altMeters;
+  double speedKmph;
+  double courseDeg;
+  int satellites;
+  bool locationValid;
+  bool altitudeValid;
+  bool speedValid;
+  bool courseValid;
+  bool satellitesValid;
+};
+
+// Civil date (proleptic Gregorian) to Unix seconds
+inline uint32_t utcToEpoch(uint16_t year, uint8_t month, uint8_t day, uint8_t hour, uint8_t minute, uint8_t second) {
+  int32_t y = year - (month <= 2 ? 1 : 0);
+  int32_t era = y / 400;
+  uint32_t yoe = y - era * 400;
+  uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+  uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  int32_t days = era * 146097 + (int32_t)doe - 719468;
+  return (uint32_t)days * 86400UL + hour * 3600UL + minute * 60UL + second;
+}
+
+// Receiver time of day (NMEA) or of week (UBX) wraps; log replay needs a clock that doesn't
+#define GPS_CLOCK_WRAP_NMEA_MS 86400000UL    // UTC day
+#define GPS_CLOCK_WRAP_UBX_MS 604800000UL    // GPS week
+
+struct GpsClock {
+  bool started;
+  uint32_t lastGpsTimeMs;
+  uint32_t clockMs;
+};
+
+// Turn receiver time into a monotonic clock starting at 1 ms, across the rollover
+inline uint32_t gpsClockMs(GpsClock &clock, uint32_t gpsTimeMs, uint32_t wrapMs) {
+  if (clock.started) {
+    uint32_t delta = gpsTimeMs - clock.lastGpsTimeMs;
+    if ((int32_t)delta < 0) delta += wrapMs;
+    clock.clockMs += delta;
+  } else {
+    clock.clockMs = 1;
+  }
+  clock.started = true;
+  clock.lastGpsTimeMs = gpsTimeMs;
+  return clock.clockMs;
+}
+
+#endif // GPS_FIX_H
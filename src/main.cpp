@@ -5,26 +5,98 @@
 #include <Fonts/FreeSansBold12pt7b.h>
 #include <GxIO/GxIO_SPI/GxIO_SPI.h>
 #include <GxIO/GxIO.h>
-#include <TinyGPS++.h>
 #include <EEPROM.h>
 #include <SPI.h>
 #include <Wire.h>
 #include "esp_pm.h"
-#include "tahoma20pt7b.h" // Include the new font file 
-#include "tahoma15pt7b.h" // Include the 15pt font file
-#include "tahoma10pt7b.h" // Include the 10pt font file
+#include "tahoma20pt7b.h" // Include the new font file (subset, tools/font_subset.py)
+#include "tahoma10pt7b.h" // Include the 10pt font file (subset, tools/font_subset.py)
+#include "text_metrics.h" // String widths from the glyph tables
+#include "geodesy.h"      // Fast distance/bearing to targets
+#include "trig_lut.h"     // Integer sin/cos for drawing
+#include "ring_geometry.h" // Compile-time ring pixel tables
+#include "framebuffer.h"  // Raw panel buffer for whole-frame copies
+#include "widgets.h"      // Dirty-rectangle partial updates
+#include "digits.h"       // Blitter for the large numeric readouts
+#include "circle_spans.h" // Row-span circles for the panel buffer
+#include "gps_fix.h"      // Fix struct shared by the decoders
+#include "ubx.h"          // UBX framing and NAV-PVT decoding
+#include "nmea.h"         // GGA/RMC decoding, one fix per epoch
+#include "nav_filter.h"   // Position/velocity filter and extrapolation
+#include "nav_sequence.h" // Waypoint arrival state machine
 #include <math.h> // Add this include for isnan()
 #include <WiFi.h> // Include the WiFi library
 #include <BLEDevice.h>
 #include <BLEServer.h>
 #include <BLEUtils.h>
 #include <BLE2902.h>
+#include "driver/uart.h"
+#include <atomic>
+#include <ESP32Time.h>
+#include "esp_partition.h"
+#include "rom/crc.h"
 
 // Correct pin definitions for LilyGO E-Paper Watch
 #define GPS_RX 21
 #define GPS_TX 22
 #define GPS_BAUD 9600
 
+// Replay build: a recorded NMEA/UBX log is streamed from a host over the USB serial port
+// (tools/nmea_replay.py) instead of coming from the receiver, and navigation runs on log time
+#ifndef GPS_REPLAY
+#define GPS_REPLAY 0
+#endif
+#define REPLAY_BAUD 921600
+
+// GPS ingest task - NMEA is decoded off the UI thread so blocking UI code can't drop bytes
+#if GPS_REPLAY
+#define GPS_UART UART_NUM_0
+#else
+#define GPS_UART UART_NUM_1
+#endif
+#define GPS_RX_BUFFER_SIZE 2048    // UART driver ring buffer (~2 s at 9600 baud, ~180 ms at 115200)
+#define GPS_EVENT_QUEUE_SIZE 20    // UART event queue depth
+#define GPS_TASK_STACK_SIZE 4096
+#define GPS_TASK_PRIORITY 5        // Above loop() (priority 1) so decoding preempts rendering
+#define GPS_TASK_CORE 0
+#define FIX_QUEUE_SIZE 32          // Power of two - ~1.5 s of GGA+RMC fixes at 10 Hz if loop() stalls
+
+// GPS wire protocol: 0 = NMEA GGA/RMC (nmea.h), 1 = u-blox UBX NAV-PVT only (ubx.h)
+#ifndef GPS_USE_UBX
+#define GPS_USE_UBX 0
+#endif
+
+// Boot-time link negotiation
+#define GPS_FAST_BAUD 115200
+#define GPS_NAV_RATE_HZ 1          // 1, 5 or 10 - rates above 1 Hz are only requested on the fast link
+#define GPS_BAUD_PROBE_MS 1200     // Long enough to catch one 1 Hz burst
+#define GPS_POWER_ON_MS 1000       // Receiver boot time after PWR_EN before it answers on the UART
+
+// Receiver power policy - cyclic tracking while parked, continuous tracking once moving
+#define GPS_POWERSAVE_DELAY 60000      // Stationary this long (ms) before dropping to power save
+#define GPS_FULL_POWER_SPEED 5.0       // km/h - back to continuous tracking above this
+#define GPS_POWERSAVE_PERIOD_MS 5000   // Fix interval in cyclic tracking
+#define GPS_POWER_LOG_SIZE 8           // Last transitions kept for GET_STATS
+
+// Hot start - last fix kept in RTC memory across deep sleep and pushed to the receiver on wake
+#define HOT_START_MAGIC 0x48535443     // "HSTC"
+#define GPS_AIDING_POS_ACC_CM 1000000  // 10 km - the unit may have been carried while asleep
+#define GPS_AIDING_TIME_ACC_S 2        // RTC drift over a typical sleep
+#define TTFF_LOG_SIZE 8
+
+// Flight track log - fixes are delta + zigzag-varint packed into sector-sized blocks in the
+// "track" partition (partitions_track.csv), oldest block overwritten when the partition is full
+#ifndef TRACK_LOG
+#define TRACK_LOG (!GPS_REPLAY)        // Replay runs don't wear the flash
+#endif
+#define TRACK_PARTITION_SUBTYPE 0x40
+#define TRACK_BLOCK_SIZE 4096          // One flash sector: erased and programmed once per block
+#define TRACK_BLOCK_MAGIC 0x314B5254   // "TRK1"
+#define TRACK_MAX_RECORD 25            // 5 fields x 5-byte varint
+#define TRACK_INTERVAL_MS 1000         // 1 Hz - one record per GGA+RMC pair
+#define TRACK_FLYING_SPEED 8.04672     // km/h, same threshold as fuel burn and flight hours
+#define TRACK_LANDED_MS 60000          // Below flying speed this long ends the flight
+
 // Pin definitions
 #define PIN_MOTOR 4
 #define PIN_KEY 35
@@ -56,6 +128,10 @@
 #define OUTER_RADIUS  89   // Reduced by 10px
 #define INNER_RADIUS  55   // Reduced by 5px
 #define MAX_DISTANCE  30   // km - when icon reaches outer position
+#define RING_WIDTH    3    // Ring and gapped-ring line width in px
+#define RING_MID_RADIUS        (INNER_RADIUS + (OUTER_RADIUS - INNER_RADIUS) / 3)
+#define RING_TWO_THIRDS_RADIUS (INNER_RADIUS + 2 * (OUTER_RADIUS - INNER_RADIUS) / 3)
+#define COMPASS_RADIUS 24    // Compass rose ring, bottom right - reduced by 1px (diameter -2px)
 
 // Time constants - Optimized for faster updates
 #define UPDATE_INTERVAL 800    // Update every 0.8 seconds (800 ms)
@@ -106,8 +182,7 @@
 // Regular location points storage
 struct LocationPoint {
   String name;
-  double lat;
-  double lon;
+  GeoPoint pos;    // 1e-7 deg
   bool active;
 };
 
@@ -128,6 +203,26 @@ LocationPoint locationPoints[MAX_LOCATION_POINTS];
 NavigationMode currentNavMode = NAV_LOCATION; // Default to location mode
 bool navigationEnabled = true;
 
+// Render-time extrapolation (filter gains in nav_filter.h)
+#define RENDER_LEAD_MS 300                // Frame start to visible partial refresh
+
+// Frame scheduling - the next navigation frame is due when something on it would visibly move
+#ifndef REFRESH_ADAPTIVE
+#define REFRESH_ADAPTIVE 1                // 0 = fixed UPDATE_INTERVAL, to compare refreshes/hour
+#endif
+#ifndef REFRESH_MIN_MS
+#define REFRESH_MIN_MS 400                // Floor - a partial refresh takes about RENDER_LEAD_MS
+#endif
+#ifndef REFRESH_MAX_MS
+#define REFRESH_MAX_MS 5000               // Ceiling - parked or no fix, battery and satellites still update
+#endif
+#ifndef REFRESH_CLEAN_EVERY
+#define REFRESH_CLEAN_EVERY 300           // Partial refreshes between full ones against ghosting, 0 = never
+#endif
+#define REFRESH_TURN_STEP_DEG 2.0         // Ring icons (r = 71 px) move ~2.5 px
+#define REFRESH_SPEED_STEP_M 15.0         // Ground covered per frame
+#define REFRESH_MOVING_SPEED 5.0          // km/h - below this course and closing rate are GPS noise
+
 // Change detection thresholds
 #define SPEED_CHANGE_THRESHOLD 1.0     // km/h
 #define ALT_CHANGE_THRESHOLD 5.0      // feet
@@ -143,27 +238,164 @@ bool navigationEnabled = true;
 
 // Global variables
 GxIO_Class io(SPI, /*CS*/ EPD_CS, /*DC=*/EPD_DC, /*RST=*/EPD_RESET);
-GxEPD_Class display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY);
-TinyGPSPlus gps;
-HardwareSerial GPSSerial(1);
+WidgetDisplay display(io, /*RST=*/EPD_RESET, /*BUSY=*/EPD_BUSY);
+
+// GPS ingest task state
+QueueHandle_t gpsUartQueue = NULL;
+TaskHandle_t gpsTaskHandle = NULL;
+volatile uint32_t gpsBytesReceived = 0;
+volatile uint32_t gpsSentencesDecoded = 0; // NAV-PVT frames decoded (NMEA: nmea.decoded)
+volatile uint32_t gpsFifoOverflows = 0;    // Hardware FIFO overruns (bytes lost)
+volatile uint32_t gpsBufferOverflows = 0;  // Driver ring buffer full (bytes lost)
+volatile uint32_t fixQueueDrops = 0;       // Fixes discarded because loop() fell behind
+
+// Replay bookkeeping
+uint32_t replayFixes = 0;
+uint32_t replayNavUs = 0;                  // Time spent in updateGPSData() across the replay
+uint32_t gpsBaud = GPS_BAUD;               // Link rate chosen at boot
+uint8_t gpsNavRateHz = 1;                  // Fix rate requested at boot
+
+enum GPSPowerMode {
+  GPS_POWER_FULL,
+  GPS_POWER_SAVE
+};
+
+struct GPSPowerEvent {
+  uint32_t timeMs;       // millis() at the transition
+  uint8_t mode;          // GPSPowerMode entered
+  uint8_t speedKmph;     // Fix speed that triggered it
+};
+
+GPSPowerMode gpsPowerMode = GPS_POWER_FULL;
+unsigned long gpsPowerModeSince = 0;
+uint32_t gpsPowerSaveMs = 0;               // Total time spent in power save (completed periods)
+uint32_t gpsPowerTransitions = 0;
+GPSPowerEvent gpsPowerLog[GPS_POWER_LOG_SIZE];
+
+// Survives deep sleep (the receiver itself is powered off with PWR_EN)
+struct HotStartCache {
+  uint32_t magic;
+  int32_t lat;           // 1e-7 deg
+  int32_t lon;           // 1e-7 deg
+  int32_t altCm;
+  uint32_t utcEpoch;     // Time of the saved fix
+  uint8_t satellites;
+};
+
+struct TTFFRecord {
+  uint32_t ttffMs;       // Boot to first valid position
+  uint8_t aided;         // Aiding data was sent this boot
+};
+
+RTC_DATA_ATTR HotStartCache hotStartCache;
+RTC_DATA_ATTR TTFFRecord ttffLog[TTFF_LOG_SIZE];
+RTC_DATA_ATTR uint32_t ttffCount = 0;
+ESP32Time rtc;                 // System time keeps running through deep sleep
+bool rtcSynced = false;        // Set from GPS once per boot
+bool gpsAided = false;         // Aiding data sent this boot
+uint32_t ttffMs = 0;           // This boot's time to first fix, 0 until known
+
+// Flight track log block: header then payload, the rest of the sector left erased (0xFF).
+// Records are [dt ms, dLat 1e-7, dLon 1e-7, dAlt dm, dSpeed 0.1 km/h], all varints, signed
+// ones zigzag-encoded. Deltas restart from zero in each block so blocks decode on their own.
+struct TrackBlockHeader {
+  uint32_t magic;
+  uint32_t seq;          // Increments per block across the whole partition
+  uint32_t crc;          // CRC32 of the payload
+  uint32_t startEpoch;   // UTC of the first record, 0 if unknown
+  uint16_t flight;       // Increments at each takeoff
+  uint16_t count;        // Records in the block
+  uint16_t length;       // Payload bytes
+  uint16_t reserved;
+};
+
+const esp_partition_t *trackPartition = nullptr;
+uint8_t trackBlock[TRACK_BLOCK_SIZE];
+uint32_t trackSector = 0;      // Sector the current block will be written to
+uint32_t trackSeq = 0;         // Sequence number of the current block
+uint16_t trackFlight = 0;      // Flight number of the last recorded flight
+uint16_t trackCount = 0;       // Records in the current block
+uint16_t trackLength = 0;      // Payload bytes in the current block
+uint32_t trackStartEpoch = 0;
+bool trackRecording = false;
+uint32_t trackLastRecordMs = 0;
+uint32_t trackSlowSince = 0;   // When speed last dropped below flying speed, 0 while flying
+int32_t trackPrev[4];          // Previous lat, lon, alt, speed for delta encoding
+uint32_t trackPrevMs = 0;
+uint32_t trackFixes = 0;       // Records written since boot
+uint32_t trackBytes = 0;       // Payload bytes written since boot
+uint32_t trackBlocksWritten = 0;
+uint32_t trackEncodeUs = 0;    // Total time spent encoding records
+uint32_t trackFlashUs = 0;     // Last erase + program time
+
+// Single-producer (gpsTask) / single-consumer (loop) lock-free ring of fixes
+struct FixQueue {
+  Fix slots[FIX_QUEUE_SIZE];
+  std::atomic<uint32_t> head;  // Next slot to write - only gpsTask stores
+  std::atomic<uint32_t> tail;  // Next slot to read - only loop() stores
+};
+
+FixQueue fixQueue;
+Fix gpsWorking = {};   // gpsTask's fix under construction - only gpsTask and its decoders touch this
+Fix currentFix = {};   // Last fix consumed by loop() - navigation and drawing read this
+
+NMEAParser nmea = {}; // GGA/RMC decoder (nmea.h) - gpsTask only
+UBXParser ubx = {};   // NAV-PVT framer (ubx.h) - gpsTask only
 
 // Waypoint mode variables
 bool waypointMode = false;
 uint8_t currentWaypoint = 0;
 const float WAYPOINT_REACHED_DISTANCE = 0.2; // 200 meters in km
 
+// Waypoint sequencing - a state machine run per fix (nav_sequence.h); the renderer only reads currentWaypoint
+#define NAV_EVENT_QUEUE_SIZE 4
+#define NAV_MOTOR_PULSE_MS 200
+
+struct NavEvent {
+  uint8_t waypoint;    // Waypoint arrived at
+  uint8_t next;        // New current waypoint, same as waypoint if there is no other
+  uint8_t arrival;     // NavArrival
+};
+
+NavSequencer navSequencer = {};
+NavEvent navEvents[NAV_EVENT_QUEUE_SIZE]; // Filled per fix, drained by loop()
+uint8_t navEventHead = 0;
+uint8_t navEventCount = 0;
+unsigned long motorOffAt = 0;             // Non-blocking vibration, 0 when idle
+
 // BLE definitions
 BLEServer *pServer = NULL;
 BLECharacteristic *pLocationCharacteristic = NULL;
 BLECharacteristic *pResponseCharacteristic = NULL;
 bool deviceConnected = false;
 bool oldDeviceConnected = false;
+volatile bool statsRequested = false;  // GET_STATS arrived - served from loop(), not the BLE task
+
+// Location/waypoint writes from the BLE task. loop() applies them, so the target arrays, the
+// table's dirty bits and the route are only ever touched from loop().
+#define TARGET_EDIT_QUEUE_SIZE 8   // Power of two
+
+struct TargetEdit {
+  uint8_t target;      // TARGET_LOCATION + i or TARGET_WAYPOINT + i
+  char name[8];        // "L1".."L5", "W1".."W20"
+  double lat;          // As received - EEPROM keeps double degrees
+  double lon;
+  bool active;
+};
+
+// Single-producer (BLE task) / single-consumer (loop) lock-free ring, as FixQueue
+struct TargetEditQueue {
+  TargetEdit slots[TARGET_EDIT_QUEUE_SIZE];
+  std::atomic<uint32_t> head;  // Next slot to write - only the BLE task stores
+  std::atomic<uint32_t> tail;  // Next slot to read - only loop() stores
+};
+
+TargetEditQueue targetEdits;
 
 // BLE location data storage
 struct BLELocation {
   String name;
-  double lat;
-  double lon;
+  GeoPoint pos;    // 1e-7 deg
   bool active;
 };
 
@@ -213,9 +445,38 @@ class LocationCallbacks: public BLECharacteristicCallbacks {
 void setCustomCpuFrequencyMhz(uint32_t frequency);
 void updateBatteryLevel();
 void drawBackground();
-void drawRingWithGaps(int radius);
-void drawArcSegment(int radius, int angle);
+void drawStaticBackground();
+void buildStaticLayer();
+void printReadout(const char *text);
+void drawRingArcs(const RingPoint *points, int count);
+template <int Radius> void fillCircleSpans(int cx, int cy, uint16_t color);
+template <int Radius> void drawCircleSpans(int cx, int cy, uint16_t color);
+void trackCircle(int cx, int cy, int radius, uint16_t color, bool filled);
 void updateGPSData();
+void updateRenderState(unsigned long renderTimeMs);
+void refreshScheduleUpdate();
+unsigned long navNowMs();
+uint32_t replayClockMs(uint32_t gpsTimeMs);
+void replayReport(unsigned long navUs);
+void startGPSTask();
+void gpsTask(void *param);
+bool fixQueuePush(const Fix &fix);
+bool fixQueuePop(Fix &fix);
+void publishFix();
+void configureNMEAOutput();
+void sendUBX(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length);
+void configureUBXOutput();
+bool gpsProbeBaud(uint32_t baud);
+void gpsNegotiateLink();
+void gpsSetPowerMode(GPSPowerMode mode);
+void updateGPSPowerPolicy();
+void saveHotStartCache();
+void gpsSendAidingData();
+void recordTTFF();
+void trackLogBegin();
+void trackLogFix(const Fix &fix);
+void trackFlushBlock();
+void sendStats();
 void updateCenterDisplay();
 void updateNavigationIndicators();
 void setNewHomePoint();
@@ -224,14 +485,31 @@ void updateTextArea(int x, int y, int w, int h, char* text, int textX, int textY
 void drawRotatingDot();
 int getBatteryPercent();
 void drawBatteryIcon(int x, int y, int width, int height, int percentage);
+void drawBatteryOutline(int x, int y, int width, int height);
+void drawBatteryLevel(int x, int y, int width, int height, int percentage);
 void drawSatelliteIcon(int x, int y, int size);
+void drawSatelliteSymbol(int x, int y, int size);
+void drawSatelliteCount(int x, int y, int size);
 void drawJerryCan(int x, int y, int width, int height);
+void drawJerryCanOutline(int x, int y, int width, int height);
+void drawFuelLevel(int x, int y, int width, int height);
 void enterSettingsScreen();
 void drawCompassRose(int cx, int cy, int radius, float headingDegrees);
 double calculateRemainingRouteDistance(int startWaypoint);
-
-double homeLat = 0.0;
-double homeLon = 0.0;
+void targetMarkDirty(int index);
+bool targetEditPush(const TargetEdit &edit);
+bool targetEditPop(TargetEdit &edit);
+void targetEditsApply();
+void targetTableUpdate(const GeoPoint &fixPos);
+void targetTableRender(const GeoPoint &renderPos);
+void routeRebuild();
+bool routeActiveLeg(int waypoint, float &xteM, float &desiredTrack);
+void navUpdate();
+void navHandleEvents();
+void motorPulse(unsigned long ms);
+void motorService();
+
+GeoPoint home = {0, 0};
 bool homeSet = false;
 
 // Current data
@@ -245,6 +523,85 @@ double distanceToHome = 0.0;
 double courseToHome = 0.0;
 double currentCourse = 0.0;
 
+NavFilter navFilter = {};
+
+// Position and heading extrapolated to the moment the frame becomes visible
+double renderLat = 0.0;
+double renderLon = 0.0;
+double renderCourse = 0.0;
+GeoOrigin renderOrigin = {};   // Projection origin at the render position, set once per frame
+uint32_t navFrameUs = 0;       // Last updateRenderState() time, for GET_STATS
+uint32_t navFrameMaxUs = 0;
+
+// Rate-of-change frame scheduler state
+struct RefreshSchedule {
+  bool primed;
+  unsigned long startMs;         // millis() of the first navigation frame, for the per-hour rates
+  unsigned long lastNavMs;       // navNowMs() of the last frame
+  double lastCourse;
+  double lastDistanceKm;
+  uint32_t intervalMs;           // Until the next frame
+  float turnDps;                 // Inputs to the last decision, for GET_STATS
+  float closingMps;
+};
+
+RefreshSchedule refreshSchedule = { false, 0, 0, 0.0, 0.0, UPDATE_INTERVAL, 0.0f, 0.0f };
+
+// Rings and icon frames, rasterised once and copied in at the start of every frame
+uint8_t staticLayer[FRAME_BUFFER_SIZE];
+bool staticLayerReady = false;
+bool staticLayerFuel = false;      // fuelDisplayVisible when the layer was built
+uint32_t staticLayerRasterUs = 0;  // Clear + draw of the static layer, what every frame used to pay
+uint32_t staticLayerCopyUs = 0;    // Last memcpy restore
+uint32_t backgroundUs = 0;         // Last drawBackground() total, for GET_STATS
+
+// tahoma20 readout glyphs, unpacked at boot for printReadout()
+DigitFont readoutFont;
+bool bufferBlackBit = false;       // Buffer bit value of a black pixel
+
+// Navigation target table - every target's vector is computed once per fix, frames only shift
+// it by the dead-reckoned offset. Indexes: home, takeoff, 5 location points, 20 waypoints.
+#define TARGET_HOME 0
+#define TARGET_TAKEOFF 1
+#define TARGET_LOCATION 2
+#define TARGET_WAYPOINT (TARGET_LOCATION + MAX_LOCATION_POINTS)
+#define TARGET_COUNT (TARGET_WAYPOINT + MAX_WAYPOINTS)
+#define TARGET_ALL_DIRTY ((1UL << TARGET_COUNT) - 1)
+
+struct TargetTable {
+  GeoPoint pos[TARGET_COUNT];
+  bool valid[TARGET_COUNT];
+  float east[TARGET_COUNT];      // From the fix position (m), azimuthal: exact range and bearing
+  float north[TARGET_COUNT];
+  float range[TARGET_COUNT];     // At the fix (m)
+  float bearing[TARGET_COUNT];   // At the fix (deg)
+  float distance[TARGET_COUNT];  // At the render position (m)
+  float course[TARGET_COUNT];    // At the render position (deg)
+  GeoOrigin origin;              // Fix position the table was computed from
+  float renderEast;              // Render position relative to the fix (m)
+  float renderNorth;
+  uint32_t dirty;                // Bit per target whose position or active state changed
+  uint32_t refreshes;            // Target vectors computed, for GET_STATS
+};
+
+TargetTable targets = {};
+
+// Waypoint route - the active waypoints in index order with their legs, rebuilt only when a
+// waypoint changes so the remaining distance is one live distance plus a lookup
+struct RouteTable {
+  uint8_t order[MAX_WAYPOINTS];      // Waypoint indexes in route order
+  int8_t position[MAX_WAYPOINTS];    // Waypoint index -> place in order, -1 if not on the route
+  uint8_t count;
+  float legLength[MAX_WAYPOINTS];    // order[k] -> order[k + 1] (m)
+  float legTrack[MAX_WAYPOINTS];     // Initial course of that leg (deg)
+  float remaining[MAX_WAYPOINTS];    // order[k] to the end of the route (m)
+  float closingLength;               // Last waypoint back to the first (m)
+  bool dirty;
+  uint32_t rebuilds;
+};
+
+RouteTable route = {};
+
 // --- Location cycling variables ---
 int currentSelectedIcon = 0; // 0 = Home, 1 = Takeoff, 2+ = BLE locations
 unsigned long lastIconChangeTime = 0;
@@ -255,8 +612,7 @@ String selectedLocationLabel = ""; // Label of the currently selected location
 // --- End location cycling variables ---
 
 // --- New Takeoff Point Variables ---
-double takeoffLat = 0.0;
-double takeoffLon = 0.0;
+GeoPoint takeoff = {0, 0};
 bool takeoffSet = false;
 double distanceToTakeoff = 0.0;
 double courseToTakeoff = 0.0;
@@ -314,8 +670,15 @@ void setup() {
   // Initialize SPI for the display with the correct pins
   SPI.begin(SPI_SCK, -1, SPI_DIN, EPD_CS);
   
-  // Initialize GPS with correct pins
-  GPSSerial.begin(9600, SERIAL_8N1, GPS_RX, GPS_TX);
+  // Enable power to peripherals - the receiver has to be up before the link is negotiated
+  pinMode(PWR_EN, OUTPUT);
+  digitalWrite(PWR_EN, HIGH);
+#if !GPS_REPLAY
+  delay(GPS_POWER_ON_MS);
+#endif
+
+  // Initialize GPS with correct pins and start the ingest task
+  startGPSTask();
 
   // Turn off the backlight to save power
   pinMode(Backlight, OUTPUT);
@@ -326,10 +689,6 @@ void setup() {
   pinMode(PIN_MOTOR, OUTPUT);
   digitalWrite(PIN_MOTOR, LOW); // Motor is explicitly set to LOW here
   
-  // Enable power to peripherals
-  pinMode(PWR_EN, OUTPUT);
-  digitalWrite(PWR_EN, HIGH);
-  
   // --- Add startup vibration ---
   digitalWrite(PIN_MOTOR, HIGH);
   delay(150); // Vibrate for 150ms
@@ -363,11 +722,13 @@ void setup() {
   // Initialize EEPROM
   EEPROM.begin(EEPROM_SIZE);
 
-  // Load home position from EEPROM
+  // Load home position from EEPROM (stored as double degrees)
+  double homeLat, homeLon;
   EEPROM.get(HOME_LAT_ADDR, homeLat);
   EEPROM.get(HOME_LON_ADDR, homeLon);
   
   if (homeLat != 0.0 && homeLon != 0.0) {
+    home = geoPoint(homeLat, homeLon);
     homeSet = true;
   }
 
@@ -384,6 +745,9 @@ void setup() {
   EEPROM.get(FUEL_VISIBLE_ADDR, tempVisible);
   fuelDisplayVisible = (tempVisible != 0);
 
+  // Find the end of the flight track log
+  trackLogBegin();
+
   // Load total flight hours from EEPROM
   EEPROM.get(FLIGHT_HOURS_ADDR, totalFlightHours);
   if (isnan(totalFlightHours) || totalFlightHours < 0) totalFlightHours = 0.0f;
@@ -398,8 +762,7 @@ void setup() {
   EEPROM.get(BLE_LOC1_ACTIVE_ADDR, tempActive);
   if (tempLat != 0.0 || tempLon != 0.0) {
     bleLocations[0].name = "1";
-    bleLocations[0].lat = tempLat;
-    bleLocations[0].lon = tempLon;
+    bleLocations[0].pos = geoPoint(tempLat, tempLon);
     bleLocations[0].active = (tempActive != 0);
   }
   
@@ -409,8 +772,7 @@ void setup() {
   EEPROM.get(BLE_LOC2_ACTIVE_ADDR, tempActive);
   if (tempLat != 0.0 || tempLon != 0.0) {
     bleLocations[1].name = "2";
-    bleLocations[1].lat = tempLat;
-    bleLocations[1].lon = tempLon;
+    bleLocations[1].pos = geoPoint(tempLat, tempLon);
     bleLocations[1].active = (tempActive != 0);
   }
   
@@ -420,8 +782,7 @@ void setup() {
   EEPROM.get(BLE_LOC3_ACTIVE_ADDR, tempActive);
   if (tempLat != 0.0 || tempLon != 0.0) {
     bleLocations[2].name = "3";
-    bleLocations[2].lat = tempLat;
-    bleLocations[2].lon = tempLon;
+    bleLocations[2].pos = geoPoint(tempLat, tempLon);
     bleLocations[2].active = (tempActive != 0);
   }
   
@@ -431,8 +792,7 @@ void setup() {
   EEPROM.get(BLE_LOC4_ACTIVE_ADDR, tempActive);
   if (tempLat != 0.0 || tempLon != 0.0) {
     bleLocations[3].name = "4";
-    bleLocations[3].lat = tempLat;
-    bleLocations[3].lon = tempLon;
+    bleLocations[3].pos = geoPoint(tempLat, tempLon);
     bleLocations[3].active = (tempActive != 0);
   }
   
@@ -442,8 +802,7 @@ void setup() {
   EEPROM.get(BLE_LOC5_ACTIVE_ADDR, tempActive);
   if (tempLat != 0.0 || tempLon != 0.0) {
     bleLocations[4].name = "5";
-    bleLocations[4].lat = tempLat;
-    bleLocations[4].lon = tempLon;
+    bleLocations[4].pos = geoPoint(tempLat, tempLon);
     bleLocations[4].active = (tempActive != 0);
   }
 
@@ -459,8 +818,7 @@ void setup() {
     
     if (tempLat != 0.0 || tempLon != 0.0) {
       bleLocations[i].name = "W" + String(i + 1);
-      bleLocations[i].lat = tempLat;
-      bleLocations[i].lon = tempLon;
+      bleLocations[i].pos = geoPoint(tempLat, tempLon);
       bleLocations[i].active = (tempActive != 0);
     }
   }
@@ -484,12 +842,15 @@ void setup() {
     EEPROM.get(addr + 16, tempActive);
     
     if (tempLat != 0.0 || tempLon != 0.0) {
-      locationPoints[i].lat = tempLat;
-      locationPoints[i].lon = tempLon;
+      locationPoints[i].pos = geoPoint(tempLat, tempLon);
       locationPoints[i].active = (tempActive != 0);
     }
   }
 
+  // Compute every loaded target on the first fix
+  targets.dirty = TARGET_ALL_DIRTY;
+  route.dirty = true;
+
   // Initialize display with optimized settings
   display.init(0); // false = partial updates possible
   display.setRotation(0);
@@ -500,8 +861,13 @@ void setup() {
   display.fillRect(0, 0, 200, 200, GxEPD_WHITE); // Draw a 200x200 white box
   display.updateWindow(0, 0, 200, 200); // Partial update for the entire screen
 
-  // Initial full screen draw
+  // Find the buffer's black polarity from a cleared screen, then unpack the readout digits
   display.fillScreen(GxEPD_WHITE);
+  bufferBlackBit = frameBuffer(display)[0] == 0x00;
+  digitFontBuild(readoutFont, &tahoma20pt7b);
+
+  // Initial full screen draw
+  buildStaticLayer();
   drawBackground();
   display.updateWindow(0, 0, SCREEN_WIDTH, SCREEN_HEIGHT); // Full update only once
   
@@ -609,6 +975,12 @@ void parseLocationData(std::string data) {
     return;
   }
 
+  // Diagnostic counters - the notifies and the route work behind them run in loop()
+  if (dataStr == "GET_STATS") {
+    statsRequested = true;
+    return;
+  }
+
   // Check if this is a request to get current locations
   if (dataStr == "GET_LOCATIONS") {
     // Send regular locations first
@@ -618,8 +990,8 @@ void parseLocationData(std::string data) {
         snprintf(jsonBuffer, sizeof(jsonBuffer), 
                  "{\"type\":\"location\",\"name\":\"L%d\",\"lat\":%.6f,\"lon\":%.6f,\"active\":%s}", 
                  i + 1,
-                 locationPoints[i].lat, 
-                 locationPoints[i].lon, 
+                 geoFromE7(locationPoints[i].pos.lat),
+                 geoFromE7(locationPoints[i].pos.lon),
                  locationPoints[i].active ? "true" : "false");
         
         char locData[200];
@@ -636,8 +1008,8 @@ void parseLocationData(std::string data) {
         snprintf(jsonBuffer, sizeof(jsonBuffer), 
                  "{\"type\":\"waypoint\",\"name\":\"W%d\",\"lat\":%.6f,\"lon\":%.6f,\"active\":%s}", 
                  i + 1,
-                 bleLocations[i].lat, 
-                 bleLocations[i].lon, 
+                 geoFromE7(bleLocations[i].pos.lat),
+                 geoFromE7(bleLocations[i].pos.lon),
                  bleLocations[i].active ? "true" : "false");
         
         char locData[200];
@@ -691,60 +1063,40 @@ void parseLocationData(std::string data) {
   double lon = lonStr.toDouble();
   bool active = (activeStr == "ON");
   
+  TargetEdit edit = {};
+  const char *kind = NULL;
   if (type == "location") {
     // Handle location point (1-5)
     int index = name.substring(1).toInt() - 1; // Convert L1-L5 to 0-4
     if (index >= 0 && index < MAX_LOCATION_POINTS) {
-      locationPoints[index].name = name;
-      locationPoints[index].lat = lat;
-      locationPoints[index].lon = lon;
-      locationPoints[index].active = active;
-      
-      // Save to EEPROM
-      int addr = LOCATION_POINTS_START + (index * LOCATION_POINT_SIZE);
-      EEPROM.put(addr, lat);
-      EEPROM.put(addr + 8, lon);
-      EEPROM.put(addr + 16, active ? (uint8_t)1 : (uint8_t)0);
-      EEPROM.commit();
-      
-      char response[100];
-      snprintf(response, sizeof(response), "Location point %s updated", name.c_str());
-      pResponseCharacteristic->setValue(response);
-      pResponseCharacteristic->notify();
+      edit.target = TARGET_LOCATION + index;
+      kind = "Location point";
     }
   } else if (type == "waypoint") {
     // Handle waypoint (1-20)
     int index = name.substring(1).toInt() - 1; // Convert W1-W20 to 0-19
     if (index >= 0 && index < MAX_WAYPOINTS) {
-      bleLocations[index].name = name;
-      bleLocations[index].lat = lat;
-      bleLocations[index].lon = lon;
-      bleLocations[index].active = active;
-      
-      // Save to EEPROM using existing address scheme
-      int baseAddr;
-      // Waypoints W1-W5 (index 0-4) map to bleLocations[0] through bleLocations[4]
-      // These use addresses BLE_LOC1_LAT_ADDR through BLE_LOC5_LAT_ADDR
-      if (index < 5) { // Corresponds to W1-W5
-        // Base addresses for BLE_LOC1 to BLE_LOC5 are contiguous with a 17-byte step
-        baseAddr = BLE_LOC1_LAT_ADDR + (index * 17);
-      } else { // Corresponds to W6-W20 (index 5-19)
-        // Base addresses for BLE_LOC6 to BLE_LOC20 are contiguous with a 17-byte step
-        // (index - 5) maps current index (5-19) to a 0-14 range for offset calculation
-        baseAddr = BLE_LOC6_LAT_ADDR + ((index - 5) * 17);
-      }
-      
-      EEPROM.put(baseAddr, lat);
-      EEPROM.put(baseAddr + 8, lon); // 8 bytes for double lat
-      EEPROM.put(baseAddr + 16, active ? (uint8_t)1 : (uint8_t)0); // 8 bytes for double lon, then 1 byte for active status
-      EEPROM.commit();
-      
-      char response[100];
-      snprintf(response, sizeof(response), "Waypoint %s updated", name.c_str());
-      pResponseCharacteristic->setValue(response);
-      pResponseCharacteristic->notify();
+      edit.target = TARGET_WAYPOINT + index;
+      kind = "Waypoint";
     }
   }
+
+  if (kind) {
+    // Stored and saved to EEPROM by loop() - see targetEditsApply()
+    strncpy(edit.name, name.c_str(), sizeof(edit.name) - 1);
+    edit.lat = lat;
+    edit.lon = lon;
+    edit.active = active;
+
+    char response[100];
+    if (targetEditPush(edit)) {
+      snprintf(response, sizeof(response), "%s %s updated", kind, name.c_str());
+    } else {
+      snprintf(response, sizeof(response), "%s %s not saved, busy - send it again", kind, name.c_str());
+    }
+    pResponseCharacteristic->setValue(response);
+    pResponseCharacteristic->notify();
+  }
   
   // Force screen update after receiving location
   lastUpdateTime = 0;
@@ -767,12 +1119,26 @@ void loop() {
       }
   }
 
-  // Continuously process GPS data
-  while (GPSSerial.available() > 0) {
-    char c = GPSSerial.read();
-    if (gps.encode(c)) { // Process new GPS sentence
-        updateGPSData();
-    }
+  // Consume every fix gpsTask published since the last pass, oldest first
+  Fix fix;
+  while (fixQueuePop(fix)) {
+    currentFix = fix;
+#if GPS_REPLAY
+    unsigned long navStart = micros();
+    updateGPSData();
+    replayReport(micros() - navStart);
+#else
+    updateGPSData();
+#endif
+  }
+  updateGPSPowerPolicy();
+  targetEditsApply();
+  navHandleEvents();
+  motorService();
+
+  if (statsRequested) {
+    statsRequested = false;
+    sendStats();
   }
 
   // Handle display based on the current state
@@ -830,27 +1196,33 @@ void loop() {
   // --- End Button Handling Logic ---
 
   unsigned long currentTime = millis();
-  if (currentTime - lastUpdateTime >= UPDATE_INTERVAL) {
+  if (currentTime - lastUpdateTime >= refreshSchedule.intervalMs) {
       lastUpdateTime = currentTime;
 
-      display.fillScreen(GxEPD_WHITE);
+      // Bearings and distances are drawn from where we'll be when the panel shows them
+      unsigned long navStart = micros();
+      updateRenderState(navNowMs() + RENDER_LEAD_MS);
+      navFrameUs = micros() - navStart;
+      if (navFrameUs > navFrameMaxUs) navFrameMaxUs = navFrameUs;
+
+      display.widgetFrameBegin();
       display.setFont(&FreeMonoBold9pt7b);
-      drawBackground();
+      drawBackground(); // Overwrites the whole frame
 
       // --- Altitude Display (Bottom Center) ---
+      display.widgetBegin(WIDGET_ALTITUDE);
       display.setFont(&tahoma10pt7b);
       char altBuffer[10];
-      if (gps.altitude.isValid()) {
-          dtostrf(gps.altitude.meters() * 3.28084, 4, 0, altBuffer);
+      if (currentFix.altitudeValid) {
+          dtostrf(currentFix.altMeters * 3.28084, 4, 0, altBuffer);
       } else {
           strcpy(altBuffer, "---");
       }
-      int16_t alt_tbx, alt_tby; uint16_t alt_tbw, alt_tbh;
-      display.getTextBounds(altBuffer, 0, 0, &alt_tbx, &alt_tby, &alt_tbw, &alt_tbh);
-      int altX = CENTER_X - alt_tbw / 2;
+      int altX = CENTER_X - textBounds(&tahoma10pt7b, altBuffer).w / 2;
       int altY = 197; // Bottom center - moved down 5px
       display.setCursor(altX, altY);
       display.print(altBuffer);
+      display.widgetEnd();
       // --- End Altitude Display ---
 
       display.setFont(&FreeMonoBold9pt7b);
@@ -858,13 +1230,16 @@ void loop() {
       updateCenterDisplay(); // This function sets its own fonts
 
       if (homeSet || takeoffSet) {
+          display.widgetBegin(WIDGET_TARGETS);
           updateNavigationIndicators();
+          display.widgetEnd();
       }
 
-      display.updateWindow(0, 0, 200, 200); // Partial update for the entire screen
+      display.widgetFrameEnd(); // Pushes only the window that changed
+      refreshScheduleUpdate();
   }
 
-  unsigned long now = millis();
+  unsigned long now = navNowMs();
 
   // --- Fuel burn logic ---
   // Only burn fuel if speed > 5 mph (8.04672 km/h)
@@ -939,7 +1314,7 @@ void loop() {
           // Show BLE enabled message
           display.updateWindow(CENTER_X - INNER_RADIUS, CENTER_Y - INNER_RADIUS, 
                              2 * INNER_RADIUS, 2 * INNER_RADIUS, true);
-          display.fillCircle(CENTER_X, CENTER_Y, INNER_RADIUS - 1, GxEPD_WHITE);
+          fillCircleSpans<INNER_RADIUS - 1>(CENTER_X, CENTER_Y, GxEPD_WHITE);
           
           display.setFont(&FreeMonoBold9pt7b);
           display.setTextColor(GxEPD_BLACK);
@@ -981,32 +1356,993 @@ void loop() {
      prepareForSleep();
   }
 
-  // EEPROM is NOT accessed here:
-  // - No EEPROM.get() or EEPROM.put() or EEPROM.write() in the main loop
-  // - EEPROM is only accessed in setup() and in enterSettingsScreen(), and when setting a new home point
+  // EEPROM is only written on events, never on every pass:
+  // - From loop(): flight hours once a minute in flight and on landing, targetEditsApply() for
+  //   each location/waypoint sent over BLE, and navHandleEvents() when a waypoint arrival
+  //   moves to the next waypoint
+  // - setup(), enterSettingsScreen(), setNewHomePoint() and prepareForSleep()
+}
+
+// Install the UART driver with an event queue and start the task that decodes the stream
+void startGPSTask() {
+  uart_config_t uartConfig = {};
+#if GPS_REPLAY
+  uartConfig.baud_rate = REPLAY_BAUD;
+#else
+  uartConfig.baud_rate = GPS_BAUD;
+#endif
+  uartConfig.data_bits = UART_DATA_8_BITS;
+  uartConfig.parity = UART_PARITY_DISABLE;
+  uartConfig.stop_bits = UART_STOP_BITS_1;
+  uartConfig.flow_ctrl = UART_HW_FLOWCTRL_DISABLE;
+
+  uart_driver_install(GPS_UART, GPS_RX_BUFFER_SIZE, 0, GPS_EVENT_QUEUE_SIZE, &gpsUartQueue, 0);
+  uart_param_config(GPS_UART, &uartConfig);
+#if !GPS_REPLAY
+  uart_set_pin(GPS_UART, GPS_TX, GPS_RX, UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+
+  gpsNegotiateLink();
+
+#if GPS_USE_UBX
+  configureUBXOutput();
+#else
+  configureNMEAOutput();
+#endif
+
+  gpsSendAidingData();
+#endif
+
+  // Discard whatever the probes left behind before the task starts decoding
+  uart_flush_input(GPS_UART);
+  xQueueReset(gpsUartQueue);
+  ubx.badChecksum = 0;
+
+  xTaskCreatePinnedToCore(gpsTask, "gps", GPS_TASK_STACK_SIZE, NULL,
+                          GPS_TASK_PRIORITY, &gpsTaskHandle, GPS_TASK_CORE);
+}
+
+// Drains the UART on every driver event and decodes NMEA, independent of what loop() is doing
+void gpsTask(void *param) {
+  uart_event_t event;
+  uint8_t chunk[128];
+
+  for (;;) {
+    if (xQueueReceive(gpsUartQueue, &event, portMAX_DELAY) != pdTRUE) continue;
+
+    switch (event.type) {
+      case UART_DATA: {
+        size_t remaining = event.size;
+        while (remaining > 0) {
+          size_t want = remaining < sizeof(chunk) ? remaining : sizeof(chunk);
+          int n = uart_read_bytes(GPS_UART, chunk, want, 0);
+          if (n <= 0) break;
+          remaining -= n;
+          gpsBytesReceived += n;
+
+          for (int i = 0; i < n; i++) {
+#if GPS_USE_UBX
+            if (ubxEncode(ubx, chunk[i])) {
+              gpsSentencesDecoded++;
+              fillFixFromNavPVT(gpsWorking, ubx.payload);
+              publishFix();
+            }
+#else
+            if (nmeaEncode(nmea, gpsWorking, chunk[i])) publishFix();
+#endif
+          }
+        }
+        break;
+      }
+      case UART_FIFO_OVF:
+        // Bytes already lost - drop the partial data so the decoder resyncs on the next '$'
+        gpsFifoOverflows++;
+        uart_flush_input(GPS_UART);
+        xQueueReset(gpsUartQueue);
+        break;
+      case UART_BUFFER_FULL:
+        gpsBufferOverflows++;
+        uart_flush_input(GPS_UART);
+        xQueueReset(gpsUartQueue);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
+// Producer side - called from gpsTask only
+bool fixQueuePush(const Fix &fix) {
+  uint32_t head = fixQueue.head.load(std::memory_order_relaxed);
+  uint32_t tail = fixQueue.tail.load(std::memory_order_acquire);
+  if (head - tail >= FIX_QUEUE_SIZE) return false;
+  fixQueue.slots[head & (FIX_QUEUE_SIZE - 1)] = fix;
+  fixQueue.head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+// Consumer side - called from loop() only
+bool fixQueuePop(Fix &fix) {
+  uint32_t tail = fixQueue.tail.load(std::memory_order_relaxed);
+  uint32_t head = fixQueue.head.load(std::memory_order_acquire);
+  if (tail == head) return false;
+  fix = fixQueue.slots[tail & (FIX_QUEUE_SIZE - 1)];
+  fixQueue.tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// Stamp the working fix and hand a copy to loop(); if loop() has fallen behind the newest fix is dropped
+void publishFix() {
+#if GPS_REPLAY
+  gpsWorking.timestampMs = replayClockMs(gpsWorking.gpsTimeMs);
+#else
+  gpsWorking.timestampMs = millis();
+#endif
+  gpsWorking.seq++;
+  if (!fixQueuePush(gpsWorking)) fixQueueDrops++;
+}
+
+// Frame and send a UBX message to the receiver
+void sendUBX(uint8_t msgClass, uint8_t msgId, const uint8_t *payload, uint16_t length) {
+  uint8_t header[6] = {UBX_SYNC1, UBX_SYNC2, msgClass, msgId,
+                       (uint8_t)(length & 0xFF), (uint8_t)(length >> 8)};
+  uint8_t ckA = 0, ckB = 0;
+  for (int i = 2; i < 6; i++) {
+    ckA += header[i];
+    ckB += ckA;
+  }
+  for (uint16_t i = 0; i < length; i++) {
+    ckA += payload[i];
+    ckB += ckA;
+  }
+  uint8_t checksum[2] = {ckA, ckB};
+
+  uart_write_bytes(GPS_UART, header, sizeof(header));
+  if (length > 0) uart_write_bytes(GPS_UART, payload, length);
+  uart_write_bytes(GPS_UART, checksum, sizeof(checksum));
+}
+
+// Keep only GGA and RMC on the wire; receivers that don't speak UBX ignore this and the filter does the work
+void configureNMEAOutput() {
+  const uint8_t offIds[] = {0x01, 0x02, 0x03, 0x05}; // GLL, GSA, GSV, VTG
+  for (size_t i = 0; i < sizeof(offIds); i++) {
+    uint8_t cfg[3] = {UBX_CLASS_NMEA, offIds[i], 0};
+    sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_MSG, cfg, sizeof(cfg));
+  }
+  const uint8_t onIds[] = {0x00, 0x04};              // GGA, RMC
+  for (size_t i = 0; i < sizeof(onIds); i++) {
+    uint8_t cfg[3] = {UBX_CLASS_NMEA, onIds[i], 1};
+    sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_MSG, cfg, sizeof(cfg));
+  }
+}
+
+// Silence the default NMEA sentences and have the receiver emit NAV-PVT once per fix
+void configureUBXOutput() {
+  const uint8_t nmeaIds[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05}; // GGA, GLL, GSA, GSV, RMC, VTG
+  for (size_t i = 0; i < sizeof(nmeaIds); i++) {
+    uint8_t cfg[3] = {UBX_CLASS_NMEA, nmeaIds[i], 0};
+    sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_MSG, cfg, sizeof(cfg));
+  }
+  uint8_t pvt[3] = {UBX_CLASS_NAV, UBX_ID_NAV_PVT, 1};
+  sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_MSG, pvt, sizeof(pvt));
+}
+
+// Listen at one baud rate for a checksum-valid NMEA sentence or a complete NAV-PVT frame.
+// Line noise at the wrong rate never passes the checksum, so a match means the rate is right.
+bool gpsProbeBaud(uint32_t baud) {
+  uart_set_baudrate(GPS_UART, baud);
+  uart_flush_input(GPS_UART);
+  ubx.state = UBX_WAIT_SYNC1;
+
+  bool inSentence = false;
+  bool inChecksum = false;
+  uint8_t runningSum = 0;
+  uint8_t hexDigits = 0;
+  uint8_t received = 0;
+
+  unsigned long start = millis();
+  while (millis() - start < GPS_BAUD_PROBE_MS) {
+    uint8_t c;
+    if (uart_read_bytes(GPS_UART, &c, 1, pdMS_TO_TICKS(20)) != 1) continue;
+
+    if (ubxEncode(ubx, c)) return true;
+
+    if (c == '$') {
+      inSentence = true;
+      inChecksum = false;
+      runningSum = 0;
+    } else if (!inSentence) {
+      continue;
+    } else if (inChecksum) {
+      uint8_t nibble;
+      if (c >= '0' && c <= '9') nibble = c - '0';
+      else if (c >= 'A' && c <= 'F') nibble = c - 'A' + 10;
+      else { inSentence = false; continue; }
+      received = (received << 4) | nibble;
+      if (++hexDigits == 2) {
+        if (received == runningSum) return true;
+        inSentence = false;
+      }
+    } else if (c == '*') {
+      inChecksum = true;
+      hexDigits = 0;
+      received = 0;
+    } else if (c < 0x20 || c > 0x7E) {
+      inSentence = false;
+    } else {
+      runningSum ^= c;
+    }
+  }
+  return false;
+}
+
+// Find the receiver's baud, move it to GPS_FAST_BAUD and optionally raise the fix rate.
+// Every step falls back to the last rate that was heard working.
+void gpsNegotiateLink() {
+  const uint32_t candidates[] = {GPS_FAST_BAUD, GPS_BAUD, 38400, 57600, 4800};
+  uint32_t detected = 0;
+  for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++) {
+    if (gpsProbeBaud(candidates[i])) {
+      detected = candidates[i];
+      break;
+    }
+  }
+
+  if (detected == 0) {
+    // Receiver silent (cold antenna, no power yet) - stay on the factory default
+    gpsBaud = GPS_BAUD;
+    uart_set_baudrate(GPS_UART, gpsBaud);
+    return;
+  }
+  gpsBaud = detected;
+
+  if (gpsBaud != GPS_FAST_BAUD) {
+    // UBX-CFG-PRT for UART1: 8N1, UBX+NMEA in and out
+    uint8_t prt[20] = {0};
+    prt[0] = 1;                                   // portID
+    prt[4] = 0xD0; prt[5] = 0x08;                 // mode = 8N1
+    prt[8] = GPS_FAST_BAUD & 0xFF;
+    prt[9] = (GPS_FAST_BAUD >> 8) & 0xFF;
+    prt[10] = (GPS_FAST_BAUD >> 16) & 0xFF;
+    prt[11] = (GPS_FAST_BAUD >> 24) & 0xFF;
+    prt[12] = 0x03;                               // inProtoMask
+    prt[14] = 0x03;                               // outProtoMask
+    sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_PRT, prt, sizeof(prt));
+    uart_wait_tx_done(GPS_UART, pdMS_TO_TICKS(100));
+    delay(100);
+
+    if (gpsProbeBaud(GPS_FAST_BAUD)) {
+      gpsBaud = GPS_FAST_BAUD;
+    } else {
+      uart_set_baudrate(GPS_UART, gpsBaud); // Receiver didn't follow - keep the detected rate
+    }
+  }
+
+  if (GPS_NAV_RATE_HZ > 1 && gpsBaud == GPS_FAST_BAUD) {
+    uint16_t measRateMs = 1000 / GPS_NAV_RATE_HZ;
+    uint8_t rate[6] = {(uint8_t)(measRateMs & 0xFF), (uint8_t)(measRateMs >> 8),
+                       1, 0,   // navRate: one measurement per solution
+                       1, 0};  // timeRef: GPS time
+    sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_RATE, rate, sizeof(rate));
+    uart_wait_tx_done(GPS_UART, pdMS_TO_TICKS(100));
+    gpsNavRateHz = GPS_NAV_RATE_HZ;
+  }
+}
+
+// Switch the receiver between continuous and cyclic (power save) tracking and log the change
+void gpsSetPowerMode(GPSPowerMode mode) {
+#if !GPS_REPLAY
+  if (mode == GPS_POWER_SAVE) {
+    // UBX-CFG-PM2: cyclic tracking, one fix per GPS_POWERSAVE_PERIOD_MS, 10 s search retry
+    uint8_t pm2[44] = {0};
+    pm2[0] = 0x01;                                        // version
+    pm2[4] = 0x00; pm2[5] = 0x14; pm2[6] = 0x02;          // flags: updateEPH (bit 12), waitTimeFix (bit 10), cyclic tracking (mode, bits 17-18)
+    pm2[8] = GPS_POWERSAVE_PERIOD_MS & 0xFF;
+    pm2[9] = (GPS_POWERSAVE_PERIOD_MS >> 8) & 0xFF;
+    pm2[10] = (GPS_POWERSAVE_PERIOD_MS >> 16) & 0xFF;
+    pm2[12] = 10000 & 0xFF;                               // searchPeriod
+    pm2[13] = (10000 >> 8) & 0xFF;
+    sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_PM2, pm2, sizeof(pm2));
+  }
+  uint8_t rxm[2] = {0x08, (uint8_t)(mode == GPS_POWER_SAVE ? 1 : 0)}; // lpMode: 0 = continuous, 1 = power save
+  sendUBX(UBX_CLASS_CFG, UBX_ID_CFG_RXM, rxm, sizeof(rxm));
+#endif
+
+  unsigned long now = millis();
+  if (gpsPowerMode == GPS_POWER_SAVE) gpsPowerSaveMs += now - gpsPowerModeSince;
+  gpsPowerMode = mode;
+  gpsPowerModeSince = now;
+
+  GPSPowerEvent &event = gpsPowerLog[gpsPowerTransitions % GPS_POWER_LOG_SIZE];
+  event.timeMs = now;
+  event.mode = mode;
+  event.speedKmph = (uint8_t)constrain(currentFix.speedKmph, 0.0, 255.0);
+  gpsPowerTransitions++;
+}
+
+// Runs every loop(): drop to power save once parked for GPS_POWERSAVE_DELAY, wake as soon as speed rises
+void updateGPSPowerPolicy() {
+  if (waitingForGPS) return; // Never throttle acquisition
+
+  if (gpsPowerMode == GPS_POWER_FULL) {
+    if (!isMoving && millis() - lastMovementTime > GPS_POWERSAVE_DELAY) {
+      gpsSetPowerMode(GPS_POWER_SAVE);
+    }
+  } else if (currentFix.speedValid && currentFix.speedKmph > GPS_FULL_POWER_SPEED) {
+    gpsSetPowerMode(GPS_POWER_FULL);
+  }
+}
+
+// Called on the way into deep sleep
+void saveHotStartCache() {
+  if (!currentFix.locationValid) return;
+  hotStartCache.magic = HOT_START_MAGIC;
+  hotStartCache.lat = (int32_t)lround(currentFix.lat * 1e7);
+  hotStartCache.lon = (int32_t)lround(currentFix.lon * 1e7);
+  hotStartCache.altCm = currentFix.altitudeValid ? (int32_t)lround(currentFix.altMeters * 100.0) : 0;
+  hotStartCache.utcEpoch = currentFix.utcEpoch;
+  hotStartCache.satellites = currentFix.satellites;
+}
+
+// Push the cached position and the RTC's UTC to the receiver (UBX-MGA-INI, u-blox M8 and later)
+void gpsSendAidingData() {
+  if (hotStartCache.magic != HOT_START_MAGIC) return; // Cold boot, nothing cached
+
+  uint8_t pos[20] = {0};
+  pos[0] = 0x01;                                      // type: POS_LLH
+  memcpy(pos + 4, &hotStartCache.lat, 4);             // ESP32 is little-endian like UBX
+  memcpy(pos + 8, &hotStartCache.lon, 4);
+  memcpy(pos + 12, &hotStartCache.altCm, 4);
+  uint32_t posAcc = GPS_AIDING_POS_ACC_CM;
+  memcpy(pos + 16, &posAcc, 4);
+  sendUBX(UBX_CLASS_MGA, UBX_ID_MGA_INI, pos, sizeof(pos));
+
+  // Only send time if the RTC was set from GPS before sleeping
+  if (hotStartCache.utcEpoch != 0 && rtc.getEpoch() >= hotStartCache.utcEpoch) {
+    uint8_t utc[24] = {0};
+    utc[0] = 0x10;                                    // type: TIME_UTC
+    utc[3] = 0x80;                                    // leapSecs unknown
+    uint16_t year = rtc.getYear();
+    utc[4] = year & 0xFF;
+    utc[5] = year >> 8;
+    utc[6] = rtc.getMonth() + 1;                      // ESP32Time months are 0-11
+    utc[7] = rtc.getDay();
+    utc[8] = rtc.getHour(true);
+    utc[9] = rtc.getMinute();
+    utc[10] = rtc.getSecond();
+    utc[16] = GPS_AIDING_TIME_ACC_S & 0xFF;           // tAccS
+    utc[17] = GPS_AIDING_TIME_ACC_S >> 8;
+    sendUBX(UBX_CLASS_MGA, UBX_ID_MGA_INI, utc, sizeof(utc));
+  }
+  gpsAided = true;
+}
+
+// First valid position this boot
+void recordTTFF() {
+  ttffMs = millis();
+  TTFFRecord &record = ttffLog[ttffCount % TTFF_LOG_SIZE];
+  record.ttffMs = ttffMs;
+  record.aided = gpsAided ? 1 : 0;
+  ttffCount++;
+}
+
+// Find the newest block in the track partition so logging continues after it
+void trackLogBegin() {
+#if TRACK_LOG
+  trackPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                            (esp_partition_subtype_t)TRACK_PARTITION_SUBTYPE, NULL);
+  if (!trackPartition) return; // Flashed with a partition table that has no track partition
+
+  uint32_t sectors = trackPartition->size / TRACK_BLOCK_SIZE;
+  bool found = false;
+  for (uint32_t i = 0; i < sectors; i++) {
+    TrackBlockHeader header;
+    if (esp_partition_read(trackPartition, i * TRACK_BLOCK_SIZE, &header, sizeof(header)) != ESP_OK) continue;
+    if (header.magic != TRACK_BLOCK_MAGIC) continue;
+    if (!found || (int32_t)(header.seq - trackSeq) > 0) {
+      trackSeq = header.seq;
+      trackSector = i;
+      trackFlight = header.flight;
+      found = true;
+    }
+  }
+  if (found) {
+    trackSeq++;
+    trackSector = (trackSector + 1) % sectors;
+  }
+#endif
+}
+
+static void trackPutVarint(uint32_t value) {
+  while (value >= 0x80) {
+    trackBlock[sizeof(TrackBlockHeader) + trackLength++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  trackBlock[sizeof(TrackBlockHeader) + trackLength++] = (uint8_t)value;
+}
+
+// Erase the sector and program the whole block in one write, then start the next block
+void trackFlushBlock() {
+  if (!trackPartition || trackCount == 0) return;
+
+  TrackBlockHeader header;
+  header.magic = TRACK_BLOCK_MAGIC;
+  header.seq = trackSeq;
+  header.crc = crc32_le(0, trackBlock + sizeof(header), trackLength);
+  header.startEpoch = trackStartEpoch;
+  header.flight = trackFlight;
+  header.count = trackCount;
+  header.length = trackLength;
+  header.reserved = 0xFFFF;
+  memcpy(trackBlock, &header, sizeof(header));
+  memset(trackBlock + sizeof(header) + trackLength, 0xFF, TRACK_BLOCK_SIZE - sizeof(header) - trackLength);
+
+  unsigned long start = micros();
+  uint32_t offset = trackSector * TRACK_BLOCK_SIZE;
+  if (esp_partition_erase_range(trackPartition, offset, TRACK_BLOCK_SIZE) == ESP_OK) {
+    esp_partition_write(trackPartition, offset, trackBlock, TRACK_BLOCK_SIZE);
+  }
+  trackFlashUs = micros() - start;
+
+  trackBlocksWritten++;
+  trackBytes += trackLength;
+  trackSeq++;
+  trackSector = (trackSector + 1) % (trackPartition->size / TRACK_BLOCK_SIZE);
+  trackCount = 0;
+  trackLength = 0;
+}
+
+// Record one fix per TRACK_INTERVAL_MS from takeoff until TRACK_LANDED_MS after landing
+void trackLogFix(const Fix &fix) {
+  if (!trackPartition) return;
+
+  bool fast = fix.speedValid && fix.speedKmph > TRACK_FLYING_SPEED;
+  if (!trackRecording) {
+    if (!fast) return;
+    trackRecording = true;
+    trackFlight++;
+    trackFlushBlock(); // Blocks never span two flights
+  }
+  if (fast) {
+    trackSlowSince = 0;
+  } else if (trackSlowSince == 0) {
+    trackSlowSince = fix.timestampMs;
+  } else if (fix.timestampMs - trackSlowSince > TRACK_LANDED_MS) {
+    trackRecording = false;
+    trackSlowSince = 0;
+    trackFlushBlock();
+    return;
+  }
+
+  if (trackCount > 0 && fix.timestampMs - trackLastRecordMs < TRACK_INTERVAL_MS) return;
+  trackLastRecordMs = fix.timestampMs;
+
+  if (trackLength + TRACK_MAX_RECORD > TRACK_BLOCK_SIZE - (int)sizeof(TrackBlockHeader)) trackFlushBlock();
+  unsigned long start = micros();
+  if (trackCount == 0) {
+    memset(trackPrev, 0, sizeof(trackPrev));
+    trackPrevMs = fix.timestampMs;
+    trackStartEpoch = fix.utcEpoch;
+  }
+
+  int32_t record[4] = {
+    (int32_t)lround(fix.lat * 1e7),
+    (int32_t)lround(fix.lon * 1e7),
+    fix.altitudeValid ? (int32_t)lround(fix.altMeters * 10.0) : trackPrev[2],
+    fix.speedValid ? (int32_t)lround(fix.speedKmph * 10.0) : trackPrev[3]
+  };
+  trackPutVarint(fix.timestampMs - trackPrevMs);
+  for (int i = 0; i < 4; i++) {
+    int32_t delta = record[i] - trackPrev[i];
+    trackPutVarint(((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31)); // Zigzag
+    trackPrev[i] = record[i];
+  }
+  trackPrevMs = fix.timestampMs;
+  trackCount++;
+  trackFixes++;
+  trackEncodeUs += micros() - start;
+}
+
+// Send diagnostic counters over BLE, one STATS:{json} notification per subsystem.
+// Runs in loop() so the route queries below never race the navigation update.
+void sendStats() {
+  char jsonBuffer[256];
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"gps\":{\"baud\":%lu,\"rateHz\":%u,\"bytes\":%lu,\"sentences\":%lu,\"badChecksum\":%lu,\"fifoOvf\":%lu,\"bufOvf\":%lu}}",
+           (unsigned long)gpsBaud,
+           (unsigned)gpsNavRateHz,
+           (unsigned long)gpsBytesReceived,
+#if GPS_USE_UBX
+           (unsigned long)gpsSentencesDecoded,
+           (unsigned long)ubx.badChecksum,
+#else
+           (unsigned long)nmea.decoded,
+           (unsigned long)nmea.badChecksum,
+#endif
+           (unsigned long)gpsFifoOverflows,
+           (unsigned long)gpsBufferOverflows);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"nmea\":{\"accepted\":%lu,\"dropped\":%lu,\"incomplete\":%lu}}",
+           (unsigned long)nmea.accepted,
+           (unsigned long)nmea.dropped,
+           (unsigned long)nmea.incomplete);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"fix\":{\"published\":%lu,\"dropped\":%lu,\"ageMs\":%lu}}",
+           (unsigned long)gpsWorking.seq,
+           (unsigned long)fixQueueDrops,
+           (unsigned long)(millis() - currentFix.timestampMs));
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"bg\":{\"rasterUs\":%lu,\"copyUs\":%lu,\"frameUs\":%lu}}",
+           (unsigned long)staticLayerRasterUs, (unsigned long)staticLayerCopyUs, (unsigned long)backgroundUs);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"widgets\":{\"frames\":%lu,\"full\":%lu,\"partial\":%lu,\"skipped\":%lu,\"bytes\":%lu}}",
+           (unsigned long)display.frames, (unsigned long)display.fullPushes,
+           (unsigned long)display.partialPushes, (unsigned long)display.skippedFrames,
+           (unsigned long)display.pushedBytes);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  float refreshHours = refreshSchedule.primed ? (millis() - refreshSchedule.startMs) / 3600000.0f : 0.0f;
+  uint32_t panelRefreshes = display.fullPushes + display.partialPushes + display.cleanRefreshes;
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"refresh\":{\"adaptive\":%d,\"intervalMs\":%lu,\"turnDps\":%.1f,\"closingMps\":%.1f,"
+           "\"framesPerHour\":%.0f,\"refreshesPerHour\":%.0f,\"fixedPerHour\":%lu,\"clean\":%lu}}",
+           REFRESH_ADAPTIVE, (unsigned long)refreshSchedule.intervalMs,
+           refreshSchedule.turnDps, refreshSchedule.closingMps,
+           refreshHours > 0.0f ? display.frames / refreshHours : 0.0f,
+           refreshHours > 0.0f ? panelRefreshes / refreshHours : 0.0f,
+           3600000UL / UPDATE_INTERVAL, (unsigned long)display.cleanRefreshes);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"nav\":{\"frameUs\":%lu,\"maxUs\":%lu,\"targetRefreshes\":%lu}}",
+           (unsigned long)navFrameUs, (unsigned long)navFrameMaxUs, (unsigned long)targets.refreshes);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  float xte, desiredTrack;
+  bool onLeg = routeActiveLeg(currentWaypoint, xte, desiredTrack);
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"route\":{\"waypoints\":%u,\"lengthKm\":%.2f,\"rebuilds\":%lu,"
+           "\"onLeg\":%s,\"xteM\":%.0f,\"dtk\":%.0f,\"state\":%d,\"cyl\":%lu,\"bis\":%lu}}",
+           route.count, route.count ? route.remaining[0] / 1000.0 : 0.0, (unsigned long)route.rebuilds,
+           onLeg ? "true" : "false", xte, desiredTrack, (int)navSequencer.state,
+           (unsigned long)navSequencer.cylinderArrivals, (unsigned long)navSequencer.bisectorArrivals);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  uint32_t saveMs = gpsPowerSaveMs;
+  if (gpsPowerMode == GPS_POWER_SAVE) saveMs += millis() - gpsPowerModeSince;
+  int len = snprintf(jsonBuffer, sizeof(jsonBuffer),
+                     "STATS:{\"gpsPower\":{\"mode\":\"%s\",\"saveS\":%lu,\"transitions\":%lu,\"log\":[",
+                     gpsPowerMode == GPS_POWER_SAVE ? "save" : "full",
+                     (unsigned long)(saveMs / 1000),
+                     (unsigned long)gpsPowerTransitions);
+  // Oldest to newest: [millis, mode (0 full / 1 save), km/h]
+  uint32_t logCount = gpsPowerTransitions < GPS_POWER_LOG_SIZE ? gpsPowerTransitions : GPS_POWER_LOG_SIZE;
+  for (uint32_t i = 0; i < logCount && len < (int)sizeof(jsonBuffer); i++) {
+    const GPSPowerEvent &event = gpsPowerLog[(gpsPowerTransitions - logCount + i) % GPS_POWER_LOG_SIZE];
+    len += snprintf(jsonBuffer + len, sizeof(jsonBuffer) - len, "%s[%lu,%u,%u]",
+                    i ? "," : "", (unsigned long)event.timeMs, event.mode, event.speedKmph);
+  }
+  if (len < (int)sizeof(jsonBuffer)) snprintf(jsonBuffer + len, sizeof(jsonBuffer) - len, "]}}");
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  snprintf(jsonBuffer, sizeof(jsonBuffer),
+           "STATS:{\"track\":{\"ok\":%s,\"recording\":%s,\"flight\":%u,\"sector\":%lu,"
+           "\"fixes\":%lu,\"blocks\":%lu,\"bytes\":%lu,\"encUs\":%lu,\"flashUs\":%lu}}",
+           trackPartition ? "true" : "false", trackRecording ? "true" : "false", trackFlight,
+           (unsigned long)trackSector, (unsigned long)trackFixes, (unsigned long)trackBlocksWritten,
+           (unsigned long)(trackBytes + trackLength),
+           (unsigned long)(trackFixes ? trackEncodeUs / trackFixes : 0), (unsigned long)trackFlashUs);
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+  delay(100);
+
+  len = snprintf(jsonBuffer, sizeof(jsonBuffer),
+                 "STATS:{\"ttff\":{\"ms\":%lu,\"aided\":%s,\"log\":[",
+                 (unsigned long)ttffMs, gpsAided ? "true" : "false");
+  // Oldest to newest across deep-sleep wakes: [ms, aided]
+  logCount = ttffCount < TTFF_LOG_SIZE ? ttffCount : TTFF_LOG_SIZE;
+  for (uint32_t i = 0; i < logCount && len < (int)sizeof(jsonBuffer); i++) {
+    const TTFFRecord &record = ttffLog[(ttffCount - logCount + i) % TTFF_LOG_SIZE];
+    len += snprintf(jsonBuffer + len, sizeof(jsonBuffer) - len, "%s[%lu,%u]",
+                    i ? "," : "", (unsigned long)record.ttffMs, record.aided);
+  }
+  if (len < (int)sizeof(jsonBuffer)) snprintf(jsonBuffer + len, sizeof(jsonBuffer) - len, "]}}");
+  pResponseCharacteristic->setValue(jsonBuffer);
+  pResponseCharacteristic->notify();
+}
+
+// Time base for navigation bookkeeping (fuel, flight hours, extrapolation) -
+// log time during replay so accelerated runs accumulate the same totals as the real flight
+unsigned long navNowMs() {
+#if GPS_REPLAY
+  return currentFix.timestampMs;
+#else
+  return millis();
+#endif
+}
+
+// Turn receiver time into a monotonic clock starting at 1 ms, across midnight/week rollover
+uint32_t replayClockMs(uint32_t gpsTimeMs) {
+  static GpsClock clock = {};
+  return gpsClockMs(clock, gpsTimeMs, GPS_USE_UBX ? GPS_CLOCK_WRAP_UBX_MS : GPS_CLOCK_WRAP_NMEA_MS);
+}
+
+// One CSV line per consumed fix back to the host:
+// REPLAY,seq,t_ms,lat,lon,alt_ft,speed_kmh,home_km,takeoff,waypoint,fuel_l,flight_h,nav_us
+void replayReport(unsigned long navUs) {
+  replayFixes++;
+  replayNavUs += navUs;
+
+  char line[192];
+  int len = snprintf(line, sizeof(line), "REPLAY,%lu,%lu,%.6f,%.6f,%.0f,%.1f,%.3f,%d,%u,%.2f,%.4f,%lu\n",
+                     (unsigned long)currentFix.seq,
+                     (unsigned long)currentFix.timestampMs,
+                     currentLat, currentLon, currentAlt, currentSpeed,
+                     distanceToHome, takeoffSet ? 1 : 0, (unsigned)currentWaypoint,
+                     fuelLitres, totalFlightHours, navUs);
+  if (len > 0) uart_write_bytes(GPS_UART, line, len < (int)sizeof(line) ? len : sizeof(line) - 1);
+}
+
+// Source of a target table entry
+static bool targetSource(int index, GeoPoint &pos) {
+  if (index == TARGET_HOME) {
+    pos = home;
+    return homeSet;
+  }
+  if (index == TARGET_TAKEOFF) {
+    pos = takeoff;
+    return takeoffSet;
+  }
+  if (index < TARGET_WAYPOINT) {
+    const LocationPoint &point = locationPoints[index - TARGET_LOCATION];
+    pos = point.pos;
+    return point.active;
+  }
+  const BLELocation &waypoint = bleLocations[index - TARGET_WAYPOINT];
+  pos = waypoint.pos;
+  return waypoint.active;
+}
+
+// Call whenever a target's position or active state changes
+void targetMarkDirty(int index) {
+  targets.dirty |= 1UL << index;
+  if (index >= TARGET_WAYPOINT) route.dirty = true;
+}
+
+static void targetRefresh(int index) {
+  targets.valid[index] = targetSource(index, targets.pos[index]);
+  if (!targets.valid[index]) return;
+
+  float bearing;
+  float range = geoVector(targets.origin, targets.pos[index], &bearing);
+  float rad = bearing * DEG_TO_RAD;
+  targets.range[index] = range;
+  targets.bearing[index] = bearing;
+  targets.east[index] = range * sinf(rad);
+  targets.north[index] = range * cosf(rad);
+  targets.distance[index] = range;
+  targets.course[index] = bearing;
+  targets.refreshes++;
+}
+
+// Producer side - called from the BLE task only
+bool targetEditPush(const TargetEdit &edit) {
+  uint32_t head = targetEdits.head.load(std::memory_order_relaxed);
+  uint32_t tail = targetEdits.tail.load(std::memory_order_acquire);
+  if (head - tail >= TARGET_EDIT_QUEUE_SIZE) return false;
+  targetEdits.slots[head & (TARGET_EDIT_QUEUE_SIZE - 1)] = edit;
+  targetEdits.head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+// Consumer side - called from loop() only
+bool targetEditPop(TargetEdit &edit) {
+  uint32_t tail = targetEdits.tail.load(std::memory_order_relaxed);
+  uint32_t head = targetEdits.head.load(std::memory_order_acquire);
+  if (tail == head) return false;
+  edit = targetEdits.slots[tail & (TARGET_EDIT_QUEUE_SIZE - 1)];
+  targetEdits.tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+// From loop(): store the queued BLE edits, save them to EEPROM and mark them dirty
+void targetEditsApply() {
+  TargetEdit edit;
+  while (targetEditPop(edit)) {
+    int addr;
+    if (edit.target >= TARGET_WAYPOINT) {
+      int index = edit.target - TARGET_WAYPOINT;
+      bleLocations[index].name = edit.name;
+      bleLocations[index].pos = geoPoint(edit.lat, edit.lon);
+      bleLocations[index].active = edit.active;
+      // Waypoints W1-W5 use BLE_LOC1_LAT_ADDR.. and W6-W20 BLE_LOC6_LAT_ADDR.., each a 17-byte step
+      addr = index < 5 ? BLE_LOC1_LAT_ADDR + (index * 17) : BLE_LOC6_LAT_ADDR + ((index - 5) * 17);
+    } else {
+      int index = edit.target - TARGET_LOCATION;
+      locationPoints[index].name = edit.name;
+      locationPoints[index].pos = geoPoint(edit.lat, edit.lon);
+      locationPoints[index].active = edit.active;
+      addr = LOCATION_POINTS_START + (index * LOCATION_POINT_SIZE);
+    }
+    targetMarkDirty(edit.target);
+
+    EEPROM.put(addr, edit.lat);
+    EEPROM.put(addr + 8, edit.lon);  // 8 bytes for double lat
+    EEPROM.put(addr + 16, edit.active ? (uint8_t)1 : (uint8_t)0); // Then 8 for lon, 1 for active
+    EEPROM.commit();
+  }
+}
+
+// Once per fix: all targets if the position moved, otherwise only the dirty ones
+void targetTableUpdate(const GeoPoint &fixPos) {
+  uint32_t refresh = targets.dirty;
+  if (fixPos.lat != targets.origin.pos.lat || fixPos.lon != targets.origin.pos.lon) {
+    geoSetOrigin(targets.origin, fixPos);
+    refresh = TARGET_ALL_DIRTY;
+  }
+  for (int i = 0; i < TARGET_COUNT; i++) {
+    if (refresh & (1UL << i)) targetRefresh(i);
+  }
+  targets.dirty = 0;
+}
+
+// Once per frame: shift the fix-time vectors to the render position (tens of metres at most)
+void targetTableRender(const GeoPoint &renderPos) {
+  float ox, oy;
+  geoLocal(targets.origin, renderPos, ox, oy);
+  targets.renderEast = ox;
+  targets.renderNorth = oy;
+  for (int i = 0; i < TARGET_COUNT; i++) {
+    if (!targets.valid[i]) continue;
+    float x = targets.east[i] - ox;
+    float y = targets.north[i] - oy;
+    targets.distance[i] = sqrtf(x * x + y * y);
+    float course = atan2f(x, y) * RAD_TO_DEG;
+    targets.course[i] = course < 0.0f ? course + 360.0f : course;
+  }
+}
+
+// Order the active waypoints and precompute leg lengths, tracks and suffix sums
+void routeRebuild() {
+  route.dirty = false;
+  route.count = 0;
+  for (int i = 0; i < MAX_WAYPOINTS; i++) {
+    const BLELocation &waypoint = bleLocations[i];
+    bool onRoute = waypoint.active && waypoint.pos.lat != 0 && waypoint.pos.lon != 0;
+    route.position[i] = onRoute ? route.count : -1;
+    if (onRoute) route.order[route.count++] = i;
+  }
+
+  for (int k = 0; k + 1 < route.count; k++) {
+    GeoOrigin from;
+    geoSetOrigin(from, bleLocations[route.order[k]].pos);
+    route.legLength[k] = geoVector(from, bleLocations[route.order[k + 1]].pos, &route.legTrack[k]);
+  }
+  float sum = 0.0f;
+  for (int k = route.count - 1; k >= 0; k--) {
+    route.remaining[k] = sum;
+    if (k > 0) sum += route.legLength[k - 1];
+  }
+  route.closingLength = route.count > 1
+    ? geoDistance(bleLocations[route.order[route.count - 1]].pos, bleLocations[route.order[0]].pos)
+    : 0.0f;
+
+  route.rebuilds++;
+}
+
+// Cross-track error (m, positive right of track) and desired track (deg) on the leg into the
+// waypoint. Without a previous waypoint the desired track is the direct course and XTE is 0.
+bool routeActiveLeg(int waypoint, float &xteM, float &desiredTrack) {
+  if (route.dirty) routeRebuild();
+  int k = (waypoint >= 0 && waypoint < MAX_WAYPOINTS) ? route.position[waypoint] : -1;
+  if (k <= 0) {
+    xteM = 0.0f;
+    desiredTrack = k == 0 ? targets.course[TARGET_WAYPOINT + waypoint] : 0.0f;
+    return false;
+  }
+
+  // Leg endpoints relative to the render position, from the target table
+  int from = TARGET_WAYPOINT + route.order[k - 1];
+  int to = TARGET_WAYPOINT + waypoint;
+  float ax = targets.east[from] - targets.renderEast;
+  float ay = targets.north[from] - targets.renderNorth;
+  float dx = targets.east[to] - targets.east[from];
+  float dy = targets.north[to] - targets.north[from];
+  float length = sqrtf(dx * dx + dy * dy);
+  xteM = length > 0.0f ? (dx * ay - dy * ax) / length : 0.0f;
+  desiredTrack = route.legTrack[k - 1];
+  return true;
+}
+
+static void navPushEvent(uint8_t waypoint, uint8_t next, uint8_t arrival) {
+  if (navEventCount == NAV_EVENT_QUEUE_SIZE) return; // loop() stalled - drop, state already moved on
+  NavEvent &event = navEvents[(navEventHead + navEventCount) % NAV_EVENT_QUEUE_SIZE];
+  event.waypoint = waypoint;
+  event.next = next;
+  event.arrival = arrival;
+  navEventCount++;
+}
+
+// Per fix: detect arrival at the current waypoint and move on to the next active one
+void navUpdate() {
+  if (!navigationEnabled || currentNavMode != NAV_WAYPOINT || currentWaypoint >= MAX_WAYPOINTS ||
+      !bleLocations[currentWaypoint].active) {
+    navSequencer.state = NAV_STATE_IDLE;
+    return;
+  }
+
+  // The waypoint rows of the target table, computed from this fix
+  NavWaypoints waypoints;
+  waypoints.count = MAX_WAYPOINTS;
+  waypoints.active = 0;
+  for (int i = 0; i < MAX_WAYPOINTS; i++) {
+    if (bleLocations[i].active) waypoints.active |= 1UL << i;
+  }
+  waypoints.east = targets.east + TARGET_WAYPOINT;
+  waypoints.north = targets.north + TARGET_WAYPOINT;
+  waypoints.range = targets.range + TARGET_WAYPOINT;
+
+  uint8_t arrived = currentWaypoint;
+  uint8_t arrival = navSequencerUpdate(navSequencer, waypoints, currentWaypoint, WAYPOINT_REACHED_DISTANCE * 1000.0f);
+  if (arrival) navPushEvent(arrived, currentWaypoint, arrival);
+}
+
+// From loop(), between frames: persist the new waypoint and buzz
+void navHandleEvents() {
+  while (navEventCount > 0) {
+    const NavEvent &event = navEvents[navEventHead];
+    navEventHead = (navEventHead + 1) % NAV_EVENT_QUEUE_SIZE;
+    navEventCount--;
+
+    // Only a move to another waypoint buzzes - re-entering the cylinder of the only one doesn't
+    if (event.next == event.waypoint) continue;
+    EEPROM.put(CURRENT_WAYPOINT_ADDR, event.next);
+    EEPROM.commit();
+    motorPulse(NAV_MOTOR_PULSE_MS);
+  }
+}
+
+void motorPulse(unsigned long ms) {
+  digitalWrite(PIN_MOTOR, HIGH);
+  motorOffAt = millis() + ms;
+  if (motorOffAt == 0) motorOffAt = 1;
+}
+
+void motorService() {
+  if (motorOffAt != 0 && (long)(millis() - motorOffAt) >= 0) {
+    digitalWrite(PIN_MOTOR, LOW);
+    motorOffAt = 0;
+  }
+}
+
+// Refresh the render position and the target vectors drawn from it
+void updateRenderState(unsigned long renderTimeMs) {
+  if (!navFilterPredict(navFilter, renderTimeMs, renderLat, renderLon, renderCourse)) {
+    renderLat = currentLat;
+    renderLon = currentLon;
+    renderCourse = currentCourse;
+  }
+
+  geoSetOrigin(renderOrigin, geoPoint(renderLat, renderLon));
+  if (targets.dirty) targetTableUpdate(targets.origin.pos); // Target edited since the last fix
+  targetTableRender(renderOrigin.pos);
+
+  if (homeSet) {
+    distanceToHome = targets.distance[TARGET_HOME] / 1000.0;
+    courseToHome = targets.course[TARGET_HOME];
+  }
+  if (takeoffSet) {
+    distanceToTakeoff = targets.distance[TARGET_TAKEOFF] / 1000.0;
+    courseToTakeoff = targets.course[TARGET_TAKEOFF];
+  }
+}
+
+// Step of the centre distance readout, as updateCenterDisplay() formats it
+double refreshDistanceStepM(double distanceKm) {
+  if (distanceKm < 0.5) return 1.0;
+  if (distanceKm >= 1000.0) return 1000.0;
+  return 100.0;
+}
+
+// After each navigation frame: next frame when the fastest-changing value moves one display step
+void refreshScheduleUpdate() {
+  unsigned long navNow = navNowMs();
+  if (!refreshSchedule.primed) {
+    refreshSchedule.primed = true;
+    refreshSchedule.startMs = millis();
+  } else {
+    float dt = (navNow - refreshSchedule.lastNavMs) / 1000.0f;
+    if (dt > 0.0f) {
+      // Course is noise when parked; the distance can't close faster than we move (a switch of
+      // the displayed target is a jump, not a rate)
+      float speedMps = currentSpeed / 3.6;
+      float turn = fmod(renderCourse - refreshSchedule.lastCourse + 540.0, 360.0) - 180.0;
+      float closing = fabs(selectedLocationDistance - refreshSchedule.lastDistanceKm) * 1000.0f / dt;
+      bool moving = currentSpeed >= REFRESH_MOVING_SPEED;
+      refreshSchedule.turnDps = moving ? fabsf(turn) / dt : 0.0f;
+      refreshSchedule.closingMps = moving ? (closing < speedMps ? closing : speedMps) : 0.0f;
+
+      float intervalMs = REFRESH_MAX_MS;
+      if (moving) {
+        intervalMs = fminf(intervalMs, REFRESH_SPEED_STEP_M * 1000.0f / speedMps);
+      }
+      if (refreshSchedule.turnDps > 0.0f) {
+        intervalMs = fminf(intervalMs, REFRESH_TURN_STEP_DEG * 1000.0f / refreshSchedule.turnDps);
+      }
+      if (refreshSchedule.closingMps > 0.0f) {
+        intervalMs = fminf(intervalMs, refreshDistanceStepM(selectedLocationDistance) * 1000.0f / refreshSchedule.closingMps);
+      }
+      // Past the dead-reckoning horizon nothing moves until the next fix
+      if (navNow - currentFix.timestampMs > FILTER_MAX_EXTRAPOLATION_MS) intervalMs = REFRESH_MAX_MS;
+      if (intervalMs < REFRESH_MIN_MS) intervalMs = REFRESH_MIN_MS;
+#if REFRESH_ADAPTIVE
+      refreshSchedule.intervalMs = (uint32_t)intervalMs;
+#endif
+    }
+  }
+  refreshSchedule.lastNavMs = navNow;
+  refreshSchedule.lastCourse = renderCourse;
+  refreshSchedule.lastDistanceKm = selectedLocationDistance;
+
+  if (REFRESH_CLEAN_EVERY > 0 && display.pushesSinceClean >= REFRESH_CLEAN_EVERY) {
+    display.widgetRequestClean();
+  }
 }
 
 void updateGPSData() {
   bool dataChanged = false;
-  bool locationValid = gps.location.isValid();
 
-  if (gps.location.isUpdated() && locationValid) {
-    currentLat = gps.location.lat();
-    currentLon = gps.location.lng();
+  navFilterUpdate(navFilter, currentFix, GPS_TIMEOUT);
+
+  if (currentFix.locationValid) {
+    currentLat = currentFix.lat;
+    currentLon = currentFix.lon;
     dataChanged = true;
 
+    if (ttffMs == 0) recordTTFF();
+    trackLogFix(currentFix);
+    if (!rtcSynced && currentFix.utcEpoch != 0) {
+      rtc.setTime(currentFix.utcEpoch);
+      rtcSynced = true;
+    }
+
     // --- Update distances to points ---
+    targetTableUpdate(geoPoint(currentLat, currentLon));
     if (homeSet) {
-      distanceToHome = TinyGPSPlus::distanceBetween(
-        currentLat, currentLon, homeLat, homeLon) / 1000.0;
-      courseToHome = TinyGPSPlus::courseTo(
-        currentLat, currentLon, homeLat, homeLon);
+      distanceToHome = targets.range[TARGET_HOME] / 1000.0;
+      courseToHome = targets.bearing[TARGET_HOME];
       
       // --- Set takeoff point if more than 500m from home ---
       if (!takeoffSet && distanceToHome > 0.5) { // More than 500 meters from home
-        takeoffLat = currentLat;
-        takeoffLon = currentLon;
+        takeoff = targets.origin.pos;
         takeoffSet = true;
+        targetMarkDirty(TARGET_TAKEOFF);
+        targetTableUpdate(takeoff);
         
         // Vibrate to indicate takeoff point set
         digitalWrite(PIN_MOTOR, HIGH);
@@ -1016,15 +2352,15 @@ void updateGPSData() {
     }
 
     if (takeoffSet) {
-      distanceToTakeoff = TinyGPSPlus::distanceBetween(
-        currentLat, currentLon, takeoffLat, takeoffLon) / 1000.0;
-      courseToTakeoff = TinyGPSPlus::courseTo(
-        currentLat, currentLon, takeoffLat, takeoffLon);
+      distanceToTakeoff = targets.range[TARGET_TAKEOFF] / 1000.0;
+      courseToTakeoff = targets.bearing[TARGET_TAKEOFF];
     }
+
+    navUpdate();
   }
 
-  if (gps.altitude.isUpdated() && gps.altitude.isValid()) {
-    double newAlt = gps.altitude.meters() * 3.28084;
+  if (currentFix.altitudeValid) {
+    double newAlt = currentFix.altMeters * 3.28084;
     if (fabs(newAlt - currentAlt) > ALT_CHANGE_THRESHOLD) {
       currentAlt = newAlt;
       prevAlt = currentAlt;
@@ -1032,8 +2368,8 @@ void updateGPSData() {
     }
   }
 
-  if (gps.speed.isUpdated() && gps.speed.isValid()) {
-    double newSpeed = gps.speed.kmph();
+  if (currentFix.speedValid) {
+    double newSpeed = currentFix.speedKmph;
     if (fabs(newSpeed - currentSpeed) > SPEED_CHANGE_THRESHOLD) {
       currentSpeed = newSpeed;
       prevSpeed = currentSpeed;
@@ -1047,16 +2383,16 @@ void updateGPSData() {
     }
   }
 
-  if (gps.course.isUpdated() && gps.course.isValid()) {
-     double newCourseGPS = gps.course.deg();
+  if (currentFix.courseValid) {
+     double newCourseGPS = currentFix.courseDeg;
      if (fabs(newCourseGPS - currentCourse) > HEADING_CHANGE_THRESHOLD) {
         currentCourse = newCourseGPS;
         dataChanged = true;
      }
   }
 
-  if (gps.satellites.isUpdated() && gps.satellites.isValid()) {
-    int newSatellites = gps.satellites.value();
+  if (currentFix.satellitesValid) {
+    int newSatellites = currentFix.satellites;
     if (newSatellites != satellites) {
         satellites = newSatellites;
         prevSatellites = satellites;
@@ -1103,10 +2439,7 @@ void updateCenterDisplay() {
           selectedLocationDistance = distanceToTakeoff;
           selectedLocationLabel = "T";
         } else if (hasValidWaypoint && currentSelectedIcon == ++iconIdx) {
-          selectedLocationDistance = TinyGPSPlus::distanceBetween(
-            currentLat, currentLon,
-            bleLocations[currentWaypoint].lat,
-            bleLocations[currentWaypoint].lon) / 1000.0;
+          selectedLocationDistance = targets.distance[TARGET_WAYPOINT + currentWaypoint] / 1000.0;
           selectedLocationLabel = "W" + String(currentWaypoint + 1);
         } else if (hasValidWaypoint && currentSelectedIcon == ++iconIdx) {
           selectedLocationDistance = calculateRemainingRouteDistance(currentWaypoint);
@@ -1148,10 +2481,7 @@ void updateCenterDisplay() {
         if (navigationEnabled) {
           for (int i = 0; i < MAX_LOCATION_POINTS; i++) {
             if (locationPoints[i].active) {
-              double dist = TinyGPSPlus::distanceBetween(
-                currentLat, currentLon,
-                locationPoints[i].lat,
-                locationPoints[i].lon) / 1000.0;
+              double dist = targets.distance[TARGET_LOCATION + i] / 1000.0;
               items[itemCount++] = {dist, "L" + String(i + 1)};
             }
           }
@@ -1192,10 +2522,11 @@ void updateCenterDisplay() {
   }
 
   if (centerText.length() > 0) {
-    int16_t tbx, tby; uint16_t tbw, tbh;
-    if (useDistanceFont) display.setFont(&tahoma20pt7b);
-    else display.setFont(&FreeMonoBold9pt7b);
-    display.getTextBounds(centerText, 0, 0, &tbx, &tby, &tbw, &tbh);
+    display.widgetBegin(WIDGET_CENTRE);
+    const GFXfont *centerFont = useDistanceFont ? &tahoma20pt7b : &FreeMonoBold9pt7b;
+    display.setFont(centerFont);
+    TextBounds centerBounds = textBounds(centerFont, centerText.c_str());
+    uint16_t tbw = centerBounds.w, tbh = centerBounds.h;
 
     int textX;
     int distY = CENTER_Y + tbh / 2 - 15;
@@ -1203,16 +2534,15 @@ void updateCenterDisplay() {
     int decimalPos = centerText.indexOf('.');
     if (useDistanceFont && !isMeters && decimalPos != -1) {
       String beforeDecimal = centerText.substring(0, decimalPos);
-      int16_t btbx, btby; uint16_t btw, bth;
-      display.getTextBounds(beforeDecimal, 0, 0, &btbx, &btby, &btw, &bth);
-      textX = CENTER_X - btw;
+      textX = CENTER_X - textBounds(&tahoma20pt7b, beforeDecimal.c_str()).w;
     } else {
       textX = CENTER_X - tbw / 2;
     }
 
     display.setCursor(textX, distY);
     display.setTextColor(GxEPD_BLACK);
-    display.print(centerText);
+    if (useDistanceFont) printReadout(centerText.c_str());
+    else display.print(centerText);
 
     if (useDistanceFont && !waitingForGPS && selectedLocationLabel.length() > 0) {
       // Show location label (H, T, Wx, or RT)
@@ -1222,10 +2552,7 @@ void updateCenterDisplay() {
         locText = "Route"; // Just show "Route" for total distance
       }
       
-      int16_t ltbx, ltby; uint16_t ltbw, ltbh;
-      display.getTextBounds(locText, 0, 0, &ltbx, &ltby, &ltbw, &ltbh);
-      
-      int locX = CENTER_X - ltbw / 2;
+      int locX = CENTER_X - textBounds(&FreeMonoBold9pt7b, locText.c_str()).w / 2;
       int locY = distY - tbh - 5;
       
       display.setCursor(locX, locY);
@@ -1233,88 +2560,175 @@ void updateCenterDisplay() {
     }
 
     // Show current speed at the bottom
+    display.widgetBegin(WIDGET_SPEED);
     if (useDistanceFont) {
       char speedBuffer[10];
-      int speedInt = (int)round(gps.speed.kmph());
+      int speedInt = (int)round(currentFix.speedKmph);
       sprintf(speedBuffer, "%d", speedInt);
-      String speedText = String(speedBuffer);
 
       display.setFont(&tahoma20pt7b);
-      int16_t stbx, stby; uint16_t stbw, stbh;
-      display.getTextBounds(speedText, 0, 0, &stbx, &stby, &stbw, &stbh);
-
-      int speedX = CENTER_X - stbw / 2;
+      int speedX = CENTER_X - textBounds(&tahoma20pt7b, speedBuffer).w / 2;
       int speedY = distY + tbh + 15;
 
       display.setCursor(speedX, speedY);
-      display.print(speedText);
+      printReadout(speedBuffer);
     }
+    display.widgetEnd();
   }
 }
 
-void drawBackground() {
-  for (int i = 0; i < 3; i++) {
-    display.drawCircle(CENTER_X, CENTER_Y, OUTER_RADIUS - i, GxEPD_BLACK);
+// display.print() for tahoma20 numbers at the cursor, blitted from the unpacked digits
+void printReadout(const char *text) {
+  if (display.getRotation() != 0 || !digitsCanDraw(readoutFont, text)) {
+    display.print(text);
+    return;
   }
 
-  for (int i = 0; i < 3; i++) {
-    display.drawCircle(CENTER_X, CENTER_Y, INNER_RADIUS - i, GxEPD_BLACK);
+  int x = display.getCursorX();
+  int y = display.getCursorY();
+  DigitBox box;
+  int nextX = digitsDraw(frameBuffer(display), GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT, readoutFont,
+                         x, y, text, bufferBlackBit, box);
+
+  uint32_t hash = WIDGET_HASH_SEED;
+  for (const char *p = text; *p; p++) hash = (hash ^ (uint8_t)*p) * WIDGET_HASH_PRIME;
+  hash = (hash ^ ((uint32_t)(x & 0xFFFF) | ((uint32_t)(y & 0xFFFF) << 16))) * WIDGET_HASH_PRIME;
+  display.widgetTrack(box.x0, box.y0, box.x1, box.y1, hash);
+
+  display.setCursor(nextX, y);
+}
+
+// Direct buffer writes skip drawPixel(), so report the circle to the open widget
+void trackCircle(int cx, int cy, int radius, uint16_t color, bool filled) {
+  int x0 = cx - radius < 0 ? 0 : cx - radius;
+  int y0 = cy - radius < 0 ? 0 : cy - radius;
+  int x1 = cx + radius < GxDEPG0150BN_WIDTH ? cx + radius : GxDEPG0150BN_WIDTH - 1;
+  int y1 = cy + radius < GxDEPG0150BN_HEIGHT ? cy + radius : GxDEPG0150BN_HEIGHT - 1;
+  uint32_t hash = WIDGET_HASH_SEED;
+  hash = (hash ^ ((uint32_t)(cx & 0xFFFF) | ((uint32_t)(cy & 0xFFFF) << 16))) * WIDGET_HASH_PRIME;
+  hash = (hash ^ ((uint32_t)radius | ((uint32_t)color << 8) | ((uint32_t)filled << 24))) * WIDGET_HASH_PRIME;
+  display.widgetTrack(x0, y0, x1, y1, hash);
+}
+
+// display.fillCircle() with a compile-time radius, written into the buffer as row spans
+template <int Radius>
+void fillCircleSpans(int cx, int cy, uint16_t color) {
+  if (display.getRotation() != 0) {
+    display.fillCircle(cx, cy, Radius, color);
+    return;
   }
+  bool bit = color == GxEPD_BLACK ? bufferBlackBit : !bufferBlackBit;
+  circleFillSpans(frameBuffer(display), GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT, cx, cy,
+                  CircleSpans<Radius>::fill, Radius, bit);
+  trackCircle(cx, cy, Radius, color, true);
+}
 
-  int midRadius = INNER_RADIUS + (OUTER_RADIUS - INNER_RADIUS) / 3;
-  int twoThirdsRadius = INNER_RADIUS + 2 * (OUTER_RADIUS - INNER_RADIUS) / 3;
+// display.drawCircle() with a compile-time radius, likewise
+template <int Radius>
+void drawCircleSpans(int cx, int cy, uint16_t color) {
+  if (display.getRotation() != 0) {
+    display.drawCircle(cx, cy, Radius, color);
+    return;
+  }
+  bool bit = color == GxEPD_BLACK ? bufferBlackBit : !bufferBlackBit;
+  circleOutlineSpans(frameBuffer(display), GxDEPG0150BN_WIDTH, GxDEPG0150BN_HEIGHT, cx, cy,
+                     CircleSpans<Radius>::outlineLo, CircleSpans<Radius>::outlineHi, Radius, bit);
+  trackCircle(cx, cy, Radius, color, false);
+}
 
-  drawRingWithGaps(midRadius);
-  drawRingWithGaps(twoThirdsRadius);
+// Full ring circle, same pixels as display.drawCircle(CENTER_X, CENTER_Y, Radius)
+template <int Radius>
+void drawRingCircle() {
+  drawCircleSpans<Radius>(CENTER_X, CENTER_Y, GxEPD_BLACK);
+}
 
-  display.setFont(&FreeMonoBold9pt7b);
-  display.setTextColor(GxEPD_BLACK); // Ensure color is set
+// Gapped ring: four arcs from one compile-time quadrant table
+template <int Radius>
+void drawRingWithGaps() {
+  drawRingArcs(RingArcTable<Radius, RING_WIDTH>::points,
+               sizeof(RingArcTable<Radius, RING_WIDTH>::points) / sizeof(RingPoint));
+}
 
-  // Draw battery icon (Top Left)
-  drawBatteryIcon(0, 0, 40, 20, getBatteryPercent());
+// Everything on the main screen that never changes after boot
+void drawStaticBackground() {
+  static_assert(RING_WIDTH == 3, "ring circles below are unrolled for a 3px width");
+  drawRingCircle<OUTER_RADIUS>();
+  drawRingCircle<OUTER_RADIUS - 1>();
+  drawRingCircle<OUTER_RADIUS - 2>();
 
-  // Draw satellite icon (Top Right)
-  drawSatelliteIcon(175, 0, 25);
+  drawRingCircle<INNER_RADIUS>();
+  drawRingCircle<INNER_RADIUS - 1>();
+  drawRingCircle<INNER_RADIUS - 2>();
+
+  drawRingWithGaps<RING_MID_RADIUS>();
+  drawRingWithGaps<RING_TWO_THIRDS_RADIUS>();
 
-  // Draw jerry can in the bottom-left corner if visible
+  // Icon frames (Top Left battery, Top Right satellite, bottom-left jerry can if visible)
+  drawBatteryOutline(0, 0, 40, 20);
+  drawSatelliteSymbol(175, 0, 25);
   if (fuelDisplayVisible) {
-    drawJerryCan(0, 160, 45, 38);
+    drawJerryCanOutline(0, 160, 45, 38);
+  }
+}
+
+// Rasterise the static layer into the panel buffer and keep a copy of it
+void buildStaticLayer() {
+  unsigned long start = micros();
+  display.fillScreen(GxEPD_WHITE);
+  drawStaticBackground();
+  staticLayerRasterUs = micros() - start;
+
+  memcpy(staticLayer, frameBuffer(display), FRAME_BUFFER_SIZE);
+  staticLayerFuel = fuelDisplayVisible;
+  staticLayerReady = true;
+  display.widgetInvalidate();
+}
+
+// Starts a frame: replaces the whole buffer with the static layer, then draws the live parts
+void drawBackground() {
+  unsigned long start = micros();
+  if (!staticLayerReady || staticLayerFuel != fuelDisplayVisible) {
+    buildStaticLayer();
+  } else {
+    memcpy(frameBuffer(display), staticLayer, FRAME_BUFFER_SIZE);
+    staticLayerCopyUs = micros() - start;
   }
 
+  display.setFont(&FreeMonoBold9pt7b);
+  display.setTextColor(GxEPD_BLACK); // Ensure color is set
+
+  display.widgetBegin(WIDGET_BATTERY);
+  drawBatteryLevel(0, 0, 40, 20, getBatteryPercent());
+  display.widgetBegin(WIDGET_SATELLITES);
+  drawSatelliteCount(175, 0, 25);
+  display.widgetBegin(WIDGET_FUEL);
+  if (fuelDisplayVisible) {
+    drawFuelLevel(0, 160, 45, 38);
+  }
+  display.widgetBegin(WIDGET_COMPASS);
+
   // --- Draw compass rose in bottom right, single-pixel ring, diameter -2px ---
-  int compassRadius = 24; // Reduce radius by 1px (diameter -2px)
+  int compassRadius = COMPASS_RADIUS;
   int compassMargin = 3;
   int compassCx = SCREEN_WIDTH - compassRadius - compassMargin + 3;
   int compassCy = SCREEN_HEIGHT - compassRadius - compassMargin + 3;
-  float heading = currentCourse;
+  float heading = renderCourse;
   drawCompassRose(compassCx, compassCy, compassRadius, heading);
+  display.widgetEnd();
   // --- End compass rose ---
+  backgroundUs = micros() - start;
 }
 
-void drawRingWithGaps(int radius) {
-  for (int i = 0; i < 3; i++) {
-    for (int angle = 30; angle <= 60; angle++) {
-      drawArcSegment(radius - i, angle);
-    }
-    for (int angle = 120; angle <= 150; angle++) {
-      drawArcSegment(radius - i, angle);
-    }
-    for (int angle = 210; angle <= 240; angle++) {
-      drawArcSegment(radius - i, angle);
-    }
-    for (int angle = 300; angle <= 330; angle++) {
-      drawArcSegment(radius - i, angle);
-    }
+// Arcs at 30-60, 120-150, 210-240 and 300-330 deg from the 30-60 deg points
+void drawRingArcs(const RingPoint *points, int count) {
+  for (int i = 0; i < count; i++) {
+    display.drawPixel(CENTER_X + points[i].x, CENTER_Y - points[i].y, GxEPD_BLACK);
+    display.drawPixel(CENTER_X - points[i].x, CENTER_Y - points[i].y, GxEPD_BLACK);
+    display.drawPixel(CENTER_X - points[i].x, CENTER_Y + points[i].y, GxEPD_BLACK);
+    display.drawPixel(CENTER_X + points[i].x, CENTER_Y + points[i].y, GxEPD_BLACK);
   }
 }
 
-void drawArcSegment(int radius, int angle) {
-  float radians = angle * PI / 180.0;
-  int x = CENTER_X + int(radius * cos(radians));
-  int y = CENTER_Y - int(radius * sin(radians));
-  display.drawPixel(x, y, GxEPD_BLACK);
-}
-
 void updateTextArea(int x, int y, int w, int h, char* text, int textX, int textY) {
   display.updateWindow(x, y, w, h, true);
   display.fillRect(x, y, w, h, GxEPD_WHITE);
@@ -1337,25 +2751,24 @@ void updateNavigationIndicators() {
   int visibleIconCount = 0;
 
   // --- Home Indicator (always shown) ---
-  float relativeBearingHome = courseToHome - currentCourse;
+  float relativeBearingHome = courseToHome - renderCourse;
   if (relativeBearingHome < 0) relativeBearingHome += 360;
   if (relativeBearingHome >= 360) relativeBearingHome -= 360;
 
-  float radiansHome = relativeBearingHome * PI / 180.0;
+  int32_t angleHome = trigAngle(relativeBearingHome);
   int iconRadiusHome = INNER_RADIUS + 16;
-  iconX[numIcons] = CENTER_X + int(iconRadiusHome * sin(radiansHome));
-  iconY[numIcons] = CENTER_Y - int(iconRadiusHome * cos(radiansHome));
+  trigPointBearing(CENTER_X, CENTER_Y, iconRadiusHome, angleHome, iconX[numIcons], iconY[numIcons]);
   
   // Check if home icon is too close to center
   if (abs(iconX[numIcons] - CENTER_X) < 5 && abs(iconY[numIcons] - CENTER_Y) < 5) {
-    if (abs(sin(radiansHome)) < 0.1) {
-      if (cos(radiansHome) < 0) {
+    if (abs(trigSinQ15(angleHome)) < TRIG_ONE / 10) {
+      if (trigCosQ15(angleHome) < 0) {
         iconY[numIcons] = CENTER_Y + iconRadiusHome;
       } else {
         iconY[numIcons] = CENTER_Y - iconRadiusHome;
       }
-    } else if (abs(cos(radiansHome)) < 0.1) {
-      if (sin(radiansHome) > 0) {
+    } else if (abs(trigCosQ15(angleHome)) < TRIG_ONE / 10) {
+      if (trigSinQ15(angleHome) > 0) {
         iconX[numIcons] = CENTER_X + iconRadiusHome;
       } else {
         iconX[numIcons] = CENTER_X - iconRadiusHome;
@@ -1375,24 +2788,23 @@ void updateNavigationIndicators() {
 
   // --- Takeoff Indicator (if set) ---
   if (takeoffSet) {
-    float relativeBearingTakeoff = courseToTakeoff - currentCourse;
+    float relativeBearingTakeoff = courseToTakeoff - renderCourse;
     if (relativeBearingTakeoff < 0) relativeBearingTakeoff += 360;
     if (relativeBearingTakeoff >= 360) relativeBearingTakeoff -= 360;
 
-    float radiansTakeoff = relativeBearingTakeoff * PI / 180.0;
+    int32_t angleTakeoff = trigAngle(relativeBearingTakeoff);
     int iconRadiusTakeoff = INNER_RADIUS + 16;
-    iconX[numIcons] = CENTER_X + int(iconRadiusTakeoff * sin(radiansTakeoff));
-    iconY[numIcons] = CENTER_Y - int(iconRadiusTakeoff * cos(radiansTakeoff));
+    trigPointBearing(CENTER_X, CENTER_Y, iconRadiusTakeoff, angleTakeoff, iconX[numIcons], iconY[numIcons]);
     
     if (abs(iconX[numIcons] - CENTER_X) < 5 && abs(iconY[numIcons] - CENTER_Y) < 5) {
-      if (abs(sin(radiansTakeoff)) < 0.1) {
-        if (cos(radiansTakeoff) < 0) {
+      if (abs(trigSinQ15(angleTakeoff)) < TRIG_ONE / 10) {
+        if (trigCosQ15(angleTakeoff) < 0) {
           iconY[numIcons] = CENTER_Y + iconRadiusTakeoff;
         } else {
           iconY[numIcons] = CENTER_Y - iconRadiusTakeoff;
         }
-      } else if (abs(cos(radiansTakeoff)) < 0.1) {
-        if (sin(radiansTakeoff) > 0) {
+      } else if (abs(trigCosQ15(angleTakeoff)) < TRIG_ONE / 10) {
+        if (trigSinQ15(angleTakeoff) > 0) {
           iconX[numIcons] = CENTER_X + iconRadiusTakeoff;
         } else {
           iconX[numIcons] = CENTER_X - iconRadiusTakeoff;
@@ -1417,54 +2829,18 @@ void updateNavigationIndicators() {
       if (currentWaypoint >= 0 && currentWaypoint < MAX_WAYPOINTS) {
         // Show only valid and active waypoint
         if (bleLocations[currentWaypoint].active) {
-          double distToWaypoint = TinyGPSPlus::distanceBetween(
-            currentLat, currentLon, 
-            bleLocations[currentWaypoint].lat, 
-            bleLocations[currentWaypoint].lon) / 1000.0;
-
-          // If within range, move to next active waypoint
-          if (distToWaypoint <= WAYPOINT_REACHED_DISTANCE) {
-            // Find next active waypoint
-            int nextWaypoint = currentWaypoint;
-            bool foundNext = false;
-            
-            // Only look for next waypoint up to MAX_WAYPOINTS
-            for (int i = 1; i < MAX_WAYPOINTS; i++) {
-              int checkPoint = (currentWaypoint + i) % MAX_WAYPOINTS;
-              if (bleLocations[checkPoint].active) {
-                nextWaypoint = checkPoint;
-                foundNext = true;
-                break;
-              }
-            }
-
-            if (foundNext) {
-              currentWaypoint = nextWaypoint;
-              EEPROM.put(CURRENT_WAYPOINT_ADDR, currentWaypoint);
-              EEPROM.commit();
-
-              // Vibrate to indicate waypoint reached
-              digitalWrite(PIN_MOTOR, HIGH);
-              delay(200);
-              digitalWrite(PIN_MOTOR, LOW);
-            }
-          }
+          double distToWaypoint = targets.distance[TARGET_WAYPOINT + currentWaypoint] / 1000.0;
 
           // Calculate bearing to current waypoint
-          double courseToWaypoint = TinyGPSPlus::courseTo(
-            currentLat, currentLon,
-            bleLocations[currentWaypoint].lat,
-            bleLocations[currentWaypoint].lon);
+          float courseToWaypoint = targets.course[TARGET_WAYPOINT + currentWaypoint];
 
-          float relativeBearing = courseToWaypoint - currentCourse;
+          float relativeBearing = courseToWaypoint - renderCourse;
           if (relativeBearing < 0) relativeBearing += 360;
           if (relativeBearing >= 360) relativeBearing -= 360;
 
-          float radians = relativeBearing * PI / 180.0;
           int iconRadius = INNER_RADIUS + 16;
           
-          iconX[numIcons] = CENTER_X + int(iconRadius * sin(radians));
-          iconY[numIcons] = CENTER_Y - int(iconRadius * cos(radians));
+          trigPointBearing(CENTER_X, CENTER_Y, iconRadius, trigAngle(relativeBearing), iconX[numIcons], iconY[numIcons]);
           iconVisible[numIcons] = true;
           iconLabels[numIcons] = "W" + String(currentWaypoint + 1);
           iconDistances[numIcons] = distToWaypoint;
@@ -1476,25 +2852,16 @@ void updateNavigationIndicators() {
       // Show all active location points
       for (int i = 0; i < MAX_LOCATION_POINTS; i++) {
         if (locationPoints[i].name != "" && locationPoints[i].active) {
-          double distToLocation = TinyGPSPlus::distanceBetween(
-            currentLat, currentLon,
-            locationPoints[i].lat,
-            locationPoints[i].lon) / 1000.0;
+          double distToLocation = targets.distance[TARGET_LOCATION + i] / 1000.0;
+          float courseToLocation = targets.course[TARGET_LOCATION + i];
 
-          double courseToLocation = TinyGPSPlus::courseTo(
-            currentLat, currentLon,
-            locationPoints[i].lat,
-            locationPoints[i].lon);
-
-          float relativeBearing = courseToLocation - currentCourse;
+          float relativeBearing = courseToLocation - renderCourse;
           if (relativeBearing < 0) relativeBearing += 360;
           if (relativeBearing >= 360) relativeBearing -= 360;
 
-          float radians = relativeBearing * PI / 180.0;
           int iconRadius = INNER_RADIUS + 16;
 
-          iconX[numIcons] = CENTER_X + int(iconRadius * sin(radians));
-          iconY[numIcons] = CENTER_Y - int(iconRadius * cos(radians));
+          trigPointBearing(CENTER_X, CENTER_Y, iconRadius, trigAngle(relativeBearing), iconX[numIcons], iconY[numIcons]);
           iconVisible[numIcons] = true;
           iconLabels[numIcons] = "L" + String(i + 1);
           iconDistances[numIcons] = distToLocation;
@@ -1506,7 +2873,7 @@ void updateNavigationIndicators() {
   }
 
   // Draw all visible icons
-  int dotDrawRadius = 15; // Reverted to 15
+  constexpr int dotDrawRadius = 15; // Reverted to 15
   display.setFont(&tahoma10pt7b); // Changed from tahoma15pt7b for better fit
   
   // Check for collisions between all visible icons
@@ -1531,14 +2898,15 @@ void updateNavigationIndicators() {
           break;
         }
         
-        // For other icons, adjust positions to prevent overlap
-        float angle = atan2(dy, dx);
+        // For other icons, push both apart along the line between them (dx/distance is the cosine)
         int adjust = COLLISION_DISTANCE - distance;
+        int shiftX = distance > 0 ? dx * adjust / (2 * distance) : adjust / 2;
+        int shiftY = distance > 0 ? dy * adjust / (2 * distance) : 0;
         
-        iconX[j] -= int(cos(angle) * adjust / 2);
-        iconY[j] -= int(sin(angle) * adjust / 2);
-        iconX[i] += int(cos(angle) * adjust / 2);
-        iconY[i] += int(sin(angle) * adjust / 2);
+        iconX[j] -= shiftX;
+        iconY[j] -= shiftY;
+        iconX[i] += shiftX;
+        iconY[i] += shiftY;
       }
     }
   }
@@ -1551,12 +2919,12 @@ void updateNavigationIndicators() {
         continue;
       }
       
-      display.fillCircle(iconX[i], iconY[i], dotDrawRadius, GxEPD_BLACK);
+      fillCircleSpans<dotDrawRadius>(iconX[i], iconY[i], GxEPD_BLACK);
       display.setTextColor(GxEPD_WHITE);
       
       String labelChar = iconLabels[i];
-      int16_t tbx, tby; uint16_t tbw, tbh;
-      display.getTextBounds(labelChar, 0, 0, &tbx, &tby, &tbw, &tbh);
+      TextBounds label = textBounds(&tahoma10pt7b, labelChar.c_str());
+      int16_t tbx = label.x, tby = label.y; uint16_t tbw = label.w, tbh = label.h;
       
       // Adjust text position for better centering with smaller font
       int textX = iconX[i] - tbw / 2 - tbx;
@@ -1587,16 +2955,17 @@ void updateNavigationIndicators() {
 }
 
 void setNewHomePoint() {
-  if (gps.location.isValid() && satellites >= 4) {  // Ensure we have a good GPS fix with enough satellites
+  if (currentFix.locationValid && satellites >= 4) {  // Ensure we have a good GPS fix with enough satellites
     // Get current coordinates
-    double newHomeLat = gps.location.lat();
-    double newHomeLon = gps.location.lng();
+    double newHomeLat = currentFix.lat;
+    double newHomeLon = currentFix.lon;
+    GeoPoint newHome = geoPoint(newHomeLat, newHomeLon);
     
     // Extra validation - check that coordinates are reasonable
     // If homeSet is already true, ensure the new location isn't too far from current location
     if (homeSet) {
-      double distanceToNewHome = TinyGPSPlus::distanceBetween(
-        currentLat, currentLon, newHomeLat, newHomeLon) / 1000.0; // Distance in KM
+      double distanceToNewHome = geoDistance(
+        geoPoint(currentLat, currentLon), newHome) / 1000.0; // Distance in KM
       
       // If the new home is more than 1 kilometer away from current position, reject it
       // This prevents setting home to erroneous GPS readings
@@ -1612,7 +2981,7 @@ void setNewHomePoint() {
         // Show error message
         display.updateWindow(CENTER_X - INNER_RADIUS, CENTER_Y - INNER_RADIUS, 
                            2 * INNER_RADIUS, 2 * INNER_RADIUS, true);
-        display.fillCircle(CENTER_X, CENTER_Y, INNER_RADIUS - 1, GxEPD_WHITE);
+        fillCircleSpans<INNER_RADIUS - 1>(CENTER_X, CENTER_Y, GxEPD_WHITE);
         
         display.setFont(&FreeMonoBold9pt7b);
         display.setTextColor(GxEPD_BLACK);
@@ -1640,20 +3009,21 @@ void setNewHomePoint() {
     delay(200);
     digitalWrite(PIN_MOTOR, LOW);
 
-    homeLat = newHomeLat;
-    homeLon = newHomeLon;
+    home = newHome;
     homeSet = true;
 
     // Clear takeoff indicator when new Home is set
     takeoffSet = false;
+    targetMarkDirty(TARGET_HOME);
+    targetMarkDirty(TARGET_TAKEOFF);
 
-    EEPROM.put(HOME_LAT_ADDR, homeLat);
-    EEPROM.put(HOME_LON_ADDR, homeLon);
+    EEPROM.put(HOME_LAT_ADDR, newHomeLat);
+    EEPROM.put(HOME_LON_ADDR, newHomeLon);
     EEPROM.commit();
 
     display.updateWindow(CENTER_X - INNER_RADIUS, CENTER_Y - INNER_RADIUS, 
                          2 * INNER_RADIUS, 2 * INNER_RADIUS, true);
-    display.fillCircle(CENTER_X, CENTER_Y, INNER_RADIUS - 1, GxEPD_WHITE);
+    fillCircleSpans<INNER_RADIUS - 1>(CENTER_X, CENTER_Y, GxEPD_WHITE);
 
     display.setFont(&FreeMonoBold9pt7b);
     display.setTextColor(GxEPD_BLACK);
@@ -1689,7 +3059,7 @@ void setNewHomePoint() {
     // Show error message
     display.updateWindow(CENTER_X - INNER_RADIUS, CENTER_Y - INNER_RADIUS, 
                        2 * INNER_RADIUS, 2 * INNER_RADIUS, true);
-    display.fillCircle(CENTER_X, CENTER_Y, INNER_RADIUS - 1, GxEPD_WHITE);
+    fillCircleSpans<INNER_RADIUS - 1>(CENTER_X, CENTER_Y, GxEPD_WHITE);
     
     display.setFont(&FreeMonoBold9pt7b);
     display.setTextColor(GxEPD_BLACK);
@@ -1728,7 +3098,7 @@ void prepareForSleep() {
   // Clear the inner circle area using partial update
   display.updateWindow(CENTER_X - INNER_RADIUS, CENTER_Y - INNER_RADIUS,
                        2 * INNER_RADIUS, 2 * INNER_RADIUS, true);
-  display.fillCircle(CENTER_X, CENTER_Y, INNER_RADIUS - 1, GxEPD_WHITE);
+  fillCircleSpans<INNER_RADIUS - 1>(CENTER_X, CENTER_Y, GxEPD_WHITE);
 
   // Set font and color for the sleep message
   display.setFont(&FreeMonoBold12pt7b);
@@ -1756,6 +3126,12 @@ void prepareForSleep() {
   EEPROM.put(FLIGHT_HOURS_ADDR, totalFlightHours);
   EEPROM.commit();
 
+  // Keep the last fix in RTC memory so the next boot can aid the receiver
+  saveHotStartCache();
+
+  // Write out the partly filled track block
+  trackFlushBlock();
+
   // Power down peripherals
   digitalWrite(PWR_EN, LOW);
   digitalWrite(Backlight, LOW); // Assuming Backlight pin is defined and used
@@ -1787,12 +3163,10 @@ void drawRotatingDot() {
   }
   lastUpdateTime = currentTime;
 
-  float radians = rotatingDotAngle * PI / 180.0;
-  int dotX = CENTER_X + int((INNER_RADIUS + 15) * cos(radians));
-  int dotY = CENTER_Y - int((INNER_RADIUS + 15) * sin(radians));
+  int dotX, dotY;
+  trigPointMath(CENTER_X, CENTER_Y, INNER_RADIUS + 15, trigAngle(rotatingDotAngle), dotX, dotY);
 
-  display.fillScreen(GxEPD_WHITE); // Full clear for this animation state
-  drawBackground(); // Redraw static background elements (rings, labels)
+  drawBackground(); // Full frame: static layer plus live background elements
 
   // --- Total Flight Hours Above "Wait GPS" ---
   display.setFont(&FreeMonoBold9pt7b);
@@ -1856,7 +3230,7 @@ void drawRotatingDot() {
   }
 
   // Draw the moving dot
-  display.fillCircle(dotX, dotY, 11, GxEPD_BLACK);
+  fillCircleSpans<11>(dotX, dotY, GxEPD_BLACK);
 
   display.updateWindow(0, 0, 200, 200);
 
@@ -1873,12 +3247,19 @@ int getBatteryPercent() {
 }
 
 void drawBatteryIcon(int x, int y, int width, int height, int percentage) {
+  drawBatteryOutline(x, y, width, height);
+  drawBatteryLevel(x, y, width, height, percentage);
+}
+
+void drawBatteryOutline(int x, int y, int width, int height) {
   // Draw the rounded rectangle outline of the battery
   display.drawRoundRect(x, y, width, height, 4, GxEPD_BLACK); // Rounded corners
 
   // Draw the positive terminal (now a bit smaller and offset)
   display.fillRect(x + width + 1, y + height / 3, 2, height / 3, GxEPD_BLACK); // Smaller terminal
+}
 
+void drawBatteryLevel(int x, int y, int width, int height, int percentage) {
   // Calculate the fill width based on the percentage
   int fillWidth = (int)((float)(width - 6) * (float)percentage / 100.0); // Leave space for rounded corners
 
@@ -1887,6 +3268,11 @@ void drawBatteryIcon(int x, int y, int width, int height, int percentage) {
 }
 
 void drawSatelliteIcon(int x, int y, int size) {
+  drawSatelliteSymbol(x, y, size);
+  drawSatelliteCount(x, y, size);
+}
+
+void drawSatelliteSymbol(int x, int y, int size) {
   // Simple satellite representation (you can customize this)
   int centerX = x + size / 2;
   int centerY = y + size / 2;
@@ -1900,25 +3286,31 @@ void drawSatelliteIcon(int x, int y, int size) {
 
   // Antenna
   display.drawLine(centerX, centerY, centerX, y, GxEPD_BLACK);
+}
 
+void drawSatelliteCount(int x, int y, int size) {
   // Display satellite count below the icon
   display.setFont(&FreeMonoBold9pt7b);
   display.setTextColor(GxEPD_BLACK);
   char satBuffer[4];
-  if (gps.satellites.isValid()) {
-    sprintf(satBuffer, "%d", gps.satellites.value());
+  if (currentFix.satellitesValid) {
+    sprintf(satBuffer, "%d", currentFix.satellites);
   } else {
     strcpy(satBuffer, "---");
   }
-  int16_t tbx, tby; uint16_t tbw, tbh;
-  display.getTextBounds(satBuffer, 0, 0, &tbx, &tby, &tbw, &tbh);
-  int textX = x + (size - tbw) / 2 - 10; // Move 10px to the left
-  int textY = y + size + tbh;
+  TextBounds count = textBounds(&FreeMonoBold9pt7b, satBuffer);
+  int textX = x + (size - count.w) / 2 - 10; // Move 10px to the left
+  int textY = y + size + count.h;
   display.setCursor(textX, textY);
   display.print(satBuffer);
 }
 
 void drawJerryCan(int x, int y, int width, int height) {
+  drawJerryCanOutline(x, y, width, height);
+  drawFuelLevel(x, y, width, height);
+}
+
+void drawJerryCanOutline(int x, int y, int width, int height) {
   // Ensure the can fits on screen
   if (y + height > SCREEN_HEIGHT) {
     height = SCREEN_HEIGHT - y;
@@ -1949,6 +3341,13 @@ void drawJerryCan(int x, int y, int width, int height) {
   display.drawLine(x + 2, y + 2, x + tri, y + 2, GxEPD_BLACK);
   display.drawLine(x + 2, y + 2, x + 2, y + tri, GxEPD_BLACK);
   display.drawLine(x + tri, y + 2, x + 2, y + tri, GxEPD_BLACK);
+}
+
+void drawFuelLevel(int x, int y, int width, int height) {
+  // Ensure the can fits on screen
+  if (y + height > SCREEN_HEIGHT) {
+    height = SCREEN_HEIGHT - y;
+  }
 
   // Draw the current fuel value in the can using tahoma10pt7b
   char buf[8];
@@ -1956,12 +3355,9 @@ void drawJerryCan(int x, int y, int width, int height) {
   display.setFont(&tahoma10pt7b);
   display.setTextColor(GxEPD_BLACK);
 
-  int16_t tbx, tby;
-  uint16_t tbw, tbh;
-  display.getTextBounds(buf, 0, 0, &tbx, &tby, &tbw, &tbh);
-
-  int textX = x + (width - tbw) / 2 - tbx;
-  int textY = y + (height + tbh) / 2 - tby - 10; // Move up 10px
+  TextBounds fuel = textBounds(&tahoma10pt7b, buf);
+  int textX = x + (width - fuel.w) / 2 - fuel.x;
+  int textY = y + (height + fuel.h) / 2 - fuel.y - 10; // Move up 10px
 
   display.setCursor(textX, textY);
   display.print(buf);
@@ -2185,15 +3581,15 @@ void enterSettingsScreen() {
 
 void drawCompassRose(int cx, int cy, int radius, float headingDegrees) {
     // Draw outer circle (single pixel)
-    display.drawCircle(cx, cy, radius, GxEPD_BLACK);
+    if (radius == COMPASS_RADIUS) drawCircleSpans<COMPASS_RADIUS>(cx, cy, GxEPD_BLACK);
+    else display.drawCircle(cx, cy, radius, GxEPD_BLACK);
 
     // Draw main compass lines (N, E, S, W)
     for (int i = 0; i < 4; ++i) {
-        float angle = (i * 90 - headingDegrees) * PI / 180.0;
-        int x1 = cx + (int)(cos(angle) * (radius - 2));
-        int y1 = cy + (int)(sin(angle) * (radius - 2));
-        int x2 = cx + (int)(cos(angle) * (radius / 2));
-        int y2 = cy + (int)(sin(angle) * (radius / 2));
+        int32_t angle = trigAngle(i * 90 - headingDegrees);
+        int x1, y1, x2, y2;
+        trigPointScreen(cx, cy, radius - 2, angle, x1, y1);
+        trigPointScreen(cx, cy, radius / 2, angle, x2, y2);
         display.drawLine(x1, y1, x2, y2, GxEPD_BLACK);
     }
 
@@ -2204,82 +3600,37 @@ void drawCompassRose(int cx, int cy, int radius, float headingDegrees) {
     struct { const char* label; float angle; } points[] = {
         {"N", 270}, {"E", 0}, {"S", 90}, {"W", 180}
     };
+    // The letters never change, so measure them once
+    static TextBounds labelBounds[4];
+    static bool labelsMeasured = false;
+    if (!labelsMeasured) {
+        for (int i = 0; i < 4; ++i) labelBounds[i] = textBounds(&FreeMonoBold9pt7b, points[i].label);
+        labelsMeasured = true;
+    }
     for (int i = 0; i < 4; ++i) {
-        float angle = (points[i].angle - headingDegrees) * PI / 180.0;
-        int tx = cx + (int)(cos(angle) * (radius - 10));
-        int ty = cy + (int)(sin(angle) * (radius - 10));
-        int16_t tbx, tby; uint16_t tbw, tbh;
-        display.getTextBounds(points[i].label, 0, 0, &tbx, &tby, &tbw, &tbh);
-        display.setCursor(tx - tbw / 2, ty + tbh / 2);
+        int tx, ty;
+        trigPointScreen(cx, cy, radius - 10, trigAngle(points[i].angle - headingDegrees), tx, ty);
+        display.setCursor(tx - labelBounds[i].w / 2, ty + labelBounds[i].h / 2);
         display.print(points[i].label);
     }
 }
 
 // Calculate total remaining distance in waypoint route starting from a specific waypoint
 double calculateRemainingRouteDistance(int startWaypoint) {
-    double totalDistance = 0.0;
-    double lastLat = currentLat;
-    double lastLon = currentLon;
-    
-    // Helper lambda to check if coordinates are valid
-    auto isValidCoord = [](double lat, double lon) {
-        return !isnan(lat) && !isnan(lon) && lat != 0.0 && lon != 0.0;
-    };
-    
-    if (startWaypoint >= 0 && startWaypoint < MAX_WAYPOINTS && bleLocations[startWaypoint].active && isValidCoord(bleLocations[startWaypoint].lat, bleLocations[startWaypoint].lon)) {
-        if (!isValidCoord(lastLat, lastLon)) return 0.0;
-        totalDistance = TinyGPSPlus::distanceBetween(
-            lastLat, lastLon,
-            bleLocations[startWaypoint].lat,
-            bleLocations[startWaypoint].lon) / 1000.0;
-        lastLat = bleLocations[startWaypoint].lat;
-        lastLon = bleLocations[startWaypoint].lon;
-        bool foundNextWaypoint = false;
-        for (int i = startWaypoint + 1; i < MAX_WAYPOINTS; i++) {
-            if (bleLocations[i].active && isValidCoord(bleLocations[i].lat, bleLocations[i].lon)) {
-                totalDistance += TinyGPSPlus::distanceBetween(
-                    lastLat, lastLon,
-                    bleLocations[i].lat,
-                    bleLocations[i].lon) / 1000.0;
-                lastLat = bleLocations[i].lat;
-                lastLon = bleLocations[i].lon;
-                foundNextWaypoint = true;
-            }
-        }
-        if (!foundNextWaypoint && startWaypoint > 0) {
-            for (int i = 0; i < startWaypoint; i++) {
-                if (bleLocations[i].active && isValidCoord(bleLocations[i].lat, bleLocations[i].lon)) {
-                    totalDistance += TinyGPSPlus::distanceBetween(
-                        lastLat, lastLon,
-                        bleLocations[i].lat,
-                        bleLocations[i].lon) / 1000.0;
-                    lastLat = bleLocations[i].lat;
-                    lastLon = bleLocations[i].lon;
-                }
-            }
-        }
-    } else {
-        bool isFirstWaypoint = true;
-        for (int i = 0; i < MAX_WAYPOINTS; i++) {
-            if (bleLocations[i].active && isValidCoord(bleLocations[i].lat, bleLocations[i].lon)) {
-                if (isFirstWaypoint) {
-                    if (!isValidCoord(currentLat, currentLon)) return 0.0;
-                    totalDistance = TinyGPSPlus::distanceBetween(
-                        currentLat, currentLon,
-                        bleLocations[i].lat,
-                        bleLocations[i].lon) / 1000.0;
-                    isFirstWaypoint = false;
-                } else {
-                    totalDistance += TinyGPSPlus::distanceBetween(
-                        lastLat, lastLon,
-                        bleLocations[i].lat,
-                        bleLocations[i].lon) / 1000.0;
-                }
-                lastLat = bleLocations[i].lat;
-                lastLon = bleLocations[i].lon;
-            }
-        }
+    if (route.dirty) routeRebuild();
+    if (route.count == 0) return 0.0;
+    if (renderOrigin.pos.lat == 0 || renderOrigin.pos.lon == 0) return 0.0;
+
+    int k = (startWaypoint >= 0 && startWaypoint < MAX_WAYPOINTS) ? route.position[startWaypoint] : -1;
+    if (k < 0) {
+        // Not on the route: fly to the first waypoint, then the whole route
+        return (targets.distance[TARGET_WAYPOINT + route.order[0]] + route.remaining[0]) / 1000.0;
+    }
+
+    double totalDistance = targets.distance[TARGET_WAYPOINT + startWaypoint] + route.remaining[k];
+    // From the last waypoint the route carries on from the first one
+    if (k == route.count - 1 && startWaypoint > 0 && route.count > 1) {
+        totalDistance += route.closingLength + route.remaining[0] - route.legLength[route.count - 2];
     }
-    if (isnan(totalDistance) || totalDistance < 0.0) return 0.0;
-    return totalDistance;
+    return totalDistance / 1000.0;
 }
@@ -0,0 +1,130 @@
+// Position/velocity filter and render-time extrapolation.
+//
+// An alpha-beta filter in a local tangent plane (east/north metres from a
+// reference point that is moved along with the aircraft). Each epoch's
+// position corrects the predicted state; the receiver's Doppler speed and
+// course, when valid, pull the velocity towards it. navFilterPredict()
+// dead-reckons the state to the moment a frame becomes visible. Constant time
+// per fix and no Arduino dependencies - tools/nav_replay.cpp runs logs through it.
+
+#ifndef NAV_FILTER_H
+#define NAV_FILTER_H
+
+#include <math.h>
+#include <stdint.h>
+#include "geodesy.h"
+#include "gps_fix.h"
+
+#define FILTER_ALPHA 0.6f                 // Position correction gain
+#define FILTER_BETA 0.2f                  // Velocity correction gain from position residual
+#define FILTER_VEL_GAIN 0.5f              // Blend toward the receiver's Doppler velocity
+#define FILTER_MIN_DT 0.05f               // s - guards the beta term against back-to-back fixes
+#define FILTER_REANCHOR_M 20000.0f        // Move the tangent-plane origin beyond this offset
+#define FILTER_MAX_EXTRAPOLATION_MS 2000  // Never dead-reckon further than this past the last fix
+#define FILTER_MIN_HEADING_SPEED 1.0f     // m/s - below this the displayed heading is held
+
+// Alpha-beta filter state in a local tangent plane (east/north metres from refLat/refLon)
+struct NavFilter {
+  bool valid;
+  double refLat;
+  double refLon;
+  float cosRefLat;
+  float x, y;            // Filtered position, m
+  float vx, vy;          // Filtered velocity, m/s
+  uint32_t lastMeasGpsTimeMs; // Receiver time of the last epoch fed in
+  uint32_t timestampMs;  // Fix time the state refers to
+};
+
+// Feed one fix into the alpha-beta filter; a gap longer than restartGapMs starts it over
+inline void navFilterUpdate(NavFilter &filter, const Fix &fix, uint32_t restartGapMs) {
+  if (!fix.locationValid) return;
+
+  const double metresPerDeg = GEO_EARTH_RADIUS_M * GEO_DEG_TO_RAD;
+  bool velocityValid = fix.speedValid && fix.courseValid;
+  float gpsVx = 0.0f, gpsVy = 0.0f;
+  if (velocityValid) {
+    float speedMps = fix.speedKmph / 3.6f;
+    float courseRad = fix.courseDeg * GEO_DEG_TO_RAD;
+    gpsVx = speedMps * sinf(courseRad);
+    gpsVy = speedMps * cosf(courseRad);
+  }
+
+  uint32_t gapMs = fix.timestampMs - filter.timestampMs;
+  if (!filter.valid || gapMs > restartGapMs) {
+    // (Re)start on this fix
+    filter.valid = true;
+    filter.refLat = fix.lat;
+    filter.refLon = fix.lon;
+    filter.cosRefLat = cos(fix.lat * GEO_DEG_TO_RAD);
+    filter.x = 0.0f;
+    filter.y = 0.0f;
+    filter.vx = gpsVx;
+    filter.vy = gpsVy;
+    filter.lastMeasGpsTimeMs = fix.gpsTimeMs;
+    filter.timestampMs = fix.timestampMs;
+    return;
+  }
+
+  // One measurement per epoch. A stationary receiver repeating its position is still a
+  // measurement - it pulls the velocity to zero and keeps the state's timestamp current.
+  if (fix.gpsTimeMs == filter.lastMeasGpsTimeMs) return;
+  filter.lastMeasGpsTimeMs = fix.gpsTimeMs;
+
+  float dt = gapMs / 1000.0f;
+  if (dt < FILTER_MIN_DT) dt = FILTER_MIN_DT;
+
+  float zx = (fix.lon - filter.refLon) * metresPerDeg * filter.cosRefLat;
+  float zy = (fix.lat - filter.refLat) * metresPerDeg;
+
+  // Predict, then correct with the position residual
+  float px = filter.x + filter.vx * dt;
+  float py = filter.y + filter.vy * dt;
+  float rx = zx - px;
+  float ry = zy - py;
+  filter.x = px + FILTER_ALPHA * rx;
+  filter.y = py + FILTER_ALPHA * ry;
+  filter.vx += (FILTER_BETA / dt) * rx;
+  filter.vy += (FILTER_BETA / dt) * ry;
+
+  if (velocityValid) {
+    filter.vx += FILTER_VEL_GAIN * (gpsVx - filter.vx);
+    filter.vy += FILTER_VEL_GAIN * (gpsVy - filter.vy);
+  }
+  filter.timestampMs = fix.timestampMs;
+
+  // Keep the flat-earth offsets small so float precision and the cos(lat) scale stay accurate
+  if (fabsf(filter.x) > FILTER_REANCHOR_M || fabsf(filter.y) > FILTER_REANCHOR_M) {
+    filter.refLat += filter.y / metresPerDeg;
+    filter.refLon += filter.x / (metresPerDeg * filter.cosRefLat);
+    filter.cosRefLat = cos(filter.refLat * GEO_DEG_TO_RAD);
+    filter.x = 0.0f;
+    filter.y = 0.0f;
+  }
+}
+
+// Dead-reckon the filtered state to timeMs. Course is only written while moving fast enough
+// for the velocity direction to mean something.
+inline bool navFilterPredict(const NavFilter &filter, uint32_t timeMs, double &lat, double &lon, double &course) {
+  if (!filter.valid) return false;
+
+  uint32_t aheadMs = timeMs - filter.timestampMs;
+  if ((int32_t)aheadMs < 0) aheadMs = 0;
+  if (aheadMs > FILTER_MAX_EXTRAPOLATION_MS) aheadMs = FILTER_MAX_EXTRAPOLATION_MS;
+  float dt = aheadMs / 1000.0f;
+
+  const double metresPerDeg = GEO_EARTH_RADIUS_M * GEO_DEG_TO_RAD;
+  float x = filter.x + filter.vx * dt;
+  float y = filter.y + filter.vy * dt;
+  lat = filter.refLat + y / metresPerDeg;
+  lon = filter.refLon + x / (metresPerDeg * filter.cosRefLat);
+
+  float speed = sqrtf(filter.vx * filter.vx + filter.vy * filter.vy);
+  if (speed >= FILTER_MIN_HEADING_SPEED) {
+    float deg = atan2f(filter.vx, filter.vy) * GEO_RAD_TO_DEG;
+    if (deg < 0) deg += 360.0f;
+    course = deg;
+  }
+  return true;
+}
+
+#endif // NAV_FILTER_H
@@ -0,0 +1,142 @@
+// Waypoint sequencing - a state machine run once per fix.
+//
+// A waypoint is reached by entering its cylinder, or by crossing the line
+// through it that bisects the inbound and outbound legs within
+// NAV_BISECTOR_CAPTURE_M. On arrival the next active waypoint becomes
+// current. A waypoint that starts out inside its cylinder has to be left by
+// NAV_ARRIVAL_HYSTERESIS_M before it can be reached.
+//
+// The sequencer only sees the waypoints' vectors from the fix (NavWaypoints),
+// so the firmware hands it its target table and tools/nav_replay.cpp vectors
+// computed from a waypoint file, both with geodesy.h. No Arduino dependencies.
+
+#ifndef NAV_SEQUENCE_H
+#define NAV_SEQUENCE_H
+
+#include <math.h>
+#include <stdint.h>
+
+#define NAV_ARRIVAL_HYSTERESIS_M 50.0f  // Must be this far outside the cylinder to re-arm
+#define NAV_BISECTOR_CAPTURE_M 1000.0f  // Bisector crossings further out than this don't count
+
+enum NavState {
+  NAV_STATE_IDLE,      // Not in waypoint mode or no active waypoint
+  NAV_STATE_APPROACH,  // Tracking, waiting to leave the cylinder before arming
+  NAV_STATE_ARMED      // Next cylinder entry or bisector crossing is an arrival
+};
+
+enum NavArrival {
+  NAV_ARRIVAL_CYLINDER = 1,
+  NAV_ARRIVAL_BISECTOR = 2
+};
+
+// Waypoints in route order, as vectors from the fix position
+struct NavWaypoints {
+  int count;
+  uint32_t active;       // Bit per waypoint on the route
+  const float *east;     // m
+  const float *north;
+  const float *range;
+};
+
+struct NavSequencer {
+  NavState state;
+  uint8_t stateWaypoint;      // Waypoint state refers to
+  int8_t bisectorSide;        // Side of the bisector the last armed fix was on: -1 before, 1 past, 0 unknown
+  uint32_t cylinderArrivals;
+  uint32_t bisectorArrivals;
+};
+
+inline bool navWaypointActive(const NavWaypoints &w, int waypoint) {
+  return (w.active >> waypoint) & 1;
+}
+
+// Nearest active waypoint after the given one, wrapping; -1 if none
+inline int navNextWaypoint(const NavWaypoints &w, int waypoint) {
+  for (int i = 1; i < w.count; i++) {
+    int check = (waypoint + i) % w.count;
+    if (navWaypointActive(w, check)) return check;
+  }
+  return -1;
+}
+
+// Nearest active waypoint before the given one, not wrapping; -1 for the first of the route
+inline int navPreviousWaypoint(const NavWaypoints &w, int waypoint) {
+  for (int check = waypoint - 1; check >= 0; check--) {
+    if (navWaypointActive(w, check)) return check;
+  }
+  return -1;
+}
+
+// Which side of the line through the waypoint that bisects the inbound and outbound legs
+// the fix is on (perpendicular to the inbound leg when there is no distinct outbound one):
+// 1 past it, -1 before it, 0 when there is no inbound leg. The first waypoint of the route
+// has none - the closing leg into it isn't flown before it - so it only arrives by cylinder.
+inline int8_t navBisectorSideOf(const NavWaypoints &w, int waypoint) {
+  int prev = navPreviousWaypoint(w, waypoint);
+  if (prev < 0) return 0;
+  int next = navNextWaypoint(w, waypoint);
+
+  float wx = w.east[waypoint], wy = w.north[waypoint];
+  float inX = wx - w.east[prev];
+  float inY = wy - w.north[prev];
+  float inLength = sqrtf(inX * inX + inY * inY);
+  if (inLength <= 0.0f) return 0;
+  float nx = inX / inLength, ny = inY / inLength;
+
+  if (next >= 0 && next != prev) {
+    float outX = w.east[next] - wx;
+    float outY = w.north[next] - wy;
+    float outLength = sqrtf(outX * outX + outY * outY);
+    if (outLength > 0.0f) {
+      nx += outX / outLength;
+      ny += outY / outLength;
+    }
+  }
+
+  // The fix is at -w relative to the waypoint; past the line when that lies ahead along n
+  return -(wx * nx + wy * ny) > 0.0f ? 1 : -1;
+}
+
+// Per fix, with waypoint active: detect arrival and move waypoint on to the next active one.
+// Returns the NavArrival, 0 if none.
+inline uint8_t navSequencerUpdate(NavSequencer &nav, const NavWaypoints &w, uint8_t &waypoint, float radius) {
+  float range = w.range[waypoint];
+
+  // New waypoint: armed at once unless it starts inside the cylinder
+  if (nav.state == NAV_STATE_IDLE || nav.stateWaypoint != waypoint) {
+    nav.stateWaypoint = waypoint;
+    nav.state = range > radius ? NAV_STATE_ARMED : NAV_STATE_APPROACH;
+    nav.bisectorSide = 0;
+  }
+  if (nav.state == NAV_STATE_APPROACH) {
+    if (range > radius + NAV_ARRIVAL_HYSTERESIS_M) nav.state = NAV_STATE_ARMED;
+    return 0;
+  }
+
+  // A bisector arrival is a crossing: before it on the last armed fix, past it on this one.
+  // Being past it already on the first armed fix doesn't count.
+  int8_t side = navBisectorSideOf(w, waypoint);
+  bool crossed = nav.bisectorSide < 0 && side > 0;
+  nav.bisectorSide = side;
+
+  uint8_t arrival = 0;
+  if (range <= radius) {
+    arrival = NAV_ARRIVAL_CYLINDER;
+    nav.cylinderArrivals++;
+  } else if (crossed && range <= NAV_BISECTOR_CAPTURE_M) {
+    arrival = NAV_ARRIVAL_BISECTOR;
+    nav.bisectorArrivals++;
+  }
+  if (!arrival) return 0;
+
+  int next = navNextWaypoint(w, waypoint);
+  if (next >= 0) waypoint = next;
+
+  nav.stateWaypoint = waypoint;
+  nav.state = (next >= 0 && w.range[next] > radius) ? NAV_STATE_ARMED : NAV_STATE_APPROACH;
+  nav.bisectorSide = 0;
+  return arrival;
+}
+
+#endif // NAV_SEQUENCE_H
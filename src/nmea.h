@@ -0,0 +1,262 @@
+// NMEA GGA/RMC decoding into a Fix, one epoch at a time.
+//
+// nmeaEncode() takes the receiver's byte stream one character at a time. The
+// talker/sentence ID is checked first, so sentences the navigation code never
+// uses (GSV, GSA, VTG, ...) are skipped without buffering or checksumming. GGA
+// (position, altitude, satellites) and RMC (position, speed, course, date) are
+// buffered, checksummed and split in place.
+//
+// Both are merged into the caller's Fix, and an epoch is reported only once
+// the GGA and the RMC carrying the same UTC time have both arrived - never half
+// of one epoch and half of the next. A sentence without a time can't be placed
+// in an epoch; its fields wait for the next one.
+//
+// Validity follows the sentence that last carried each field: a GGA without a
+// fix or a void RMC clears locationValid, as NAV-PVT without gnssFixOK does in
+// ubx.h. No Arduino dependencies - tools/nav_replay.cpp decodes logs with it.
+
+#ifndef NMEA_H
+#define NMEA_H
+
+#include <stdint.h>
+#include <string.h>
+#include "gps_fix.h"
+
+#define NMEA_MAX_SENTENCE 96   // 82 by the standard, with room for long multi-GNSS talkers
+#define NMEA_MAX_FIELDS 20
+#define NMEA_KNOTS_TO_KMPH 1.852
+
+enum NMEAFilterState {
+  NMEA_SKIP,     // Between sentences or inside an unwanted one
+  NMEA_HEADER,   // Collecting "$ttsss"
+  NMEA_PASS      // Wanted sentence, buffering up to the line end
+};
+
+struct NMEAParser {
+  NMEAFilterState state;
+  uint8_t length;
+  char sentence[NMEA_MAX_SENTENCE + 1];   // "$ttsss,...*hh", no line end
+  uint32_t epochTimeMs;      // UTC time of day the epoch's sentences so far carried
+  bool epochGGA;
+  bool epochRMC;
+  uint16_t year;             // From the last RMC, 0 until one had a date
+  uint8_t month;
+  uint8_t day;
+  volatile uint32_t accepted;      // GGA/RMC let through by the ID check
+  volatile uint32_t dropped;       // Other sentences skipped
+  volatile uint32_t decoded;       // Sentences that passed the checksum
+  volatile uint32_t badChecksum;   // Missing, malformed or wrong checksum, or overlong
+  volatile uint32_t incomplete;    // Epochs abandoned with only one of the two sentences
+};
+
+inline int nmeaHexDigit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  return -1;
+}
+
+// Unsigned decimal such as "4631.18373"; false if empty or not a number
+inline bool nmeaParseDecimal(const char *field, double &value) {
+  if (*field == '\0') return false;
+  double whole = 0.0, scale = 1.0;
+  bool fraction = false;
+  for (const char *p = field; *p; p++) {
+    if (*p == '.' && !fraction) {
+      fraction = true;
+    } else if (*p >= '0' && *p <= '9') {
+      whole = whole * 10.0 + (*p - '0');
+      if (fraction) scale *= 10.0;
+    } else {
+      return false;
+    }
+  }
+  value = whole / scale;
+  return true;
+}
+
+// Signed decimal, for altitudes below the geoid
+inline bool nmeaParseSigned(const char *field, double &value) {
+  bool negative = *field == '-';
+  if (!nmeaParseDecimal(field + (negative ? 1 : 0), value)) return false;
+  if (negative) value = -value;
+  return true;
+}
+
+inline bool nmeaTwoDigits(const char *p, uint8_t &value) {
+  if (p[0] < '0' || p[0] > '9' || p[1] < '0' || p[1] > '9') return false;
+  value = (p[0] - '0') * 10 + (p[1] - '0');
+  return true;
+}
+
+// "hhmmss.ss" to milliseconds of the UTC day
+inline bool nmeaParseTime(const char *field, uint32_t &timeMs, uint8_t &hour, uint8_t &minute, uint8_t &second) {
+  if (strlen(field) < 6) return false;
+  if (!nmeaTwoDigits(field, hour) || !nmeaTwoDigits(field + 2, minute) || !nmeaTwoDigits(field + 4, second)) return false;
+  double seconds = 0.0;
+  if (!nmeaParseDecimal(field + 4, seconds)) return false;
+  timeMs = (hour * 60UL + minute) * 60000UL + (uint32_t)(seconds * 1000.0 + 0.5);
+  return true;
+}
+
+// "ddmm.mmmm" / "dddmm.mmmm" and hemisphere to signed degrees
+inline bool nmeaParseCoordinate(const char *field, const char *hemisphere, double &deg) {
+  double raw;
+  if (!nmeaParseDecimal(field, raw)) return false;
+  double degrees = (double)(int32_t)(raw / 100.0);
+  deg = degrees + (raw - degrees * 100.0) / 60.0;
+  if (hemisphere[0] == 'S' || hemisphere[0] == 'W') deg = -deg;
+  else if (hemisphere[0] != 'N' && hemisphere[0] != 'E') return false;
+  return true;
+}
+
+// Checksum and split a buffered sentence in place; returns the field count, 0 if invalid
+inline int nmeaSplit(NMEAParser &nmea, char **fields) {
+  char *s = nmea.sentence;
+  int length = nmea.length;
+  if (length < 10 || s[length - 3] != '*') return 0;
+  int hi = nmeaHexDigit(s[length - 2]), lo = nmeaHexDigit(s[length - 1]);
+  if (hi < 0 || lo < 0) return 0;
+  uint8_t sum = 0;
+  for (int i = 1; i < length - 3; i++) sum ^= (uint8_t)s[i];
+  if (sum != (uint8_t)(hi << 4 | lo)) return 0;
+
+  s[length - 3] = '\0';
+  int count = 0;
+  fields[count++] = s;
+  for (char *p = s; *p; p++) {
+    if (*p != ',') continue;
+    *p = '\0';
+    if (count == NMEA_MAX_FIELDS) return 0;
+    fields[count++] = p + 1;
+  }
+  return count;
+}
+
+// GGA: time, lat, N/S, lon, E/W, quality, satellites, HDOP, altitude MSL, ...
+inline bool nmeaDecodeGGA(Fix &fix, char **f, int count, uint32_t &timeMs) {
+  uint8_t hour, minute, second;
+  if (count < 10 || !nmeaParseTime(f[1], timeMs, hour, minute, second)) return false;
+
+  bool hasFix = f[6][0] != '\0' && f[6][0] != '0';
+  double lat, lon, alt, satellites;
+  fix.locationValid = hasFix && nmeaParseCoordinate(f[2], f[3], lat) && nmeaParseCoordinate(f[4], f[5], lon);
+  if (fix.locationValid) {
+    fix.lat = lat;
+    fix.lon = lon;
+  }
+  fix.altitudeValid = hasFix && nmeaParseSigned(f[9], alt);
+  if (fix.altitudeValid) fix.altMeters = alt;
+  if (nmeaParseDecimal(f[7], satellites)) {
+    fix.satellites = (int)satellites;
+    fix.satellitesValid = true;
+  }
+  return true;
+}
+
+// RMC: time, status, lat, N/S, lon, E/W, speed (knots), course, date (ddmmyy), ...
+inline bool nmeaDecodeRMC(NMEAParser &nmea, Fix &fix, char **f, int count, uint32_t &timeMs) {
+  uint8_t hour, minute, second;
+  if (count < 10 || !nmeaParseTime(f[1], timeMs, hour, minute, second)) return false;
+
+  bool active = f[2][0] == 'A';
+  double lat, lon, knots, course;
+  fix.locationValid = active && nmeaParseCoordinate(f[3], f[4], lat) && nmeaParseCoordinate(f[5], f[6], lon);
+  if (fix.locationValid) {
+    fix.lat = lat;
+    fix.lon = lon;
+  }
+  fix.speedValid = active && nmeaParseDecimal(f[7], knots);
+  if (fix.speedValid) fix.speedKmph = knots * NMEA_KNOTS_TO_KMPH;
+  fix.courseValid = active && nmeaParseDecimal(f[8], course);   // Empty while stationary on some receivers
+  if (fix.courseValid) fix.courseDeg = course;
+
+  uint8_t day, month, year;
+  if (strlen(f[9]) == 6 && nmeaTwoDigits(f[9], day) && nmeaTwoDigits(f[9] + 2, month) &&
+      nmeaTwoDigits(f[9] + 4, year)) {
+    nmea.day = day;
+    nmea.month = month;
+    nmea.year = 2000 + year;
+  }
+  if (nmea.year >= 2020) {
+    fix.utcEpoch = utcToEpoch(nmea.year, nmea.month, nmea.day, hour, minute, second);
+  }
+  return true;
+}
+
+// A complete sentence is buffered: decode it into fix and count it towards its epoch.
+// Returns true when that completes the epoch.
+inline bool nmeaSentenceEnd(NMEAParser &nmea, Fix &fix) {
+  char *fields[NMEA_MAX_FIELDS];
+  int count = nmeaSplit(nmea, fields);
+  if (count == 0) {
+    nmea.badChecksum++;
+    return false;
+  }
+  nmea.decoded++;
+
+  bool isGGA = fields[0][3] == 'G';
+  uint32_t timeMs;
+  bool timed = isGGA ? nmeaDecodeGGA(fix, fields, count, timeMs) : nmeaDecodeRMC(nmea, fix, fields, count, timeMs);
+  if (!timed) return false;
+  fix.gpsTimeMs = timeMs;
+
+  if (timeMs != nmea.epochTimeMs) {
+    if (nmea.epochGGA || nmea.epochRMC) nmea.incomplete++;
+    nmea.epochTimeMs = timeMs;
+    nmea.epochGGA = false;
+    nmea.epochRMC = false;
+  }
+  if (isGGA) nmea.epochGGA = true;
+  else nmea.epochRMC = true;
+
+  if (!nmea.epochGGA || !nmea.epochRMC) return false;
+  nmea.epochGGA = false;
+  nmea.epochRMC = false;
+  return true;
+}
+
+// Feed one character; returns true when fix holds a complete GGA+RMC epoch
+inline bool nmeaEncode(NMEAParser &nmea, Fix &fix, char c) {
+  if (c == '$') {
+    nmea.state = NMEA_HEADER;
+    nmea.length = 0;
+  }
+
+  switch (nmea.state) {
+    case NMEA_HEADER: {
+      nmea.sentence[nmea.length++] = c;
+      if (nmea.length < 6) return false;
+
+      // "$" + 2-char talker (GP, GN, GL, ...) + 3-char sentence type
+      const char *type = nmea.sentence + 3;
+      bool wanted = (type[0] == 'G' && type[1] == 'G' && type[2] == 'A') ||
+                    (type[0] == 'R' && type[1] == 'M' && type[2] == 'C');
+      if (wanted) {
+        nmea.accepted++;
+        nmea.state = NMEA_PASS;
+      } else {
+        nmea.dropped++;
+        nmea.state = NMEA_SKIP;
+      }
+      return false;
+    }
+    case NMEA_PASS:
+      if (c == '\r' || c == '\n') {
+        nmea.state = NMEA_SKIP;
+        nmea.sentence[nmea.length] = '\0';
+        return nmeaSentenceEnd(nmea, fix);
+      }
+      if (nmea.length == NMEA_MAX_SENTENCE) {
+        nmea.badChecksum++;
+        nmea.state = NMEA_SKIP;
+        return false;
+      }
+      nmea.sentence[nmea.length++] = c;
+      return false;
+    case NMEA_SKIP:
+      return false;
+  }
+  return false;
+}
+
+#endif // NMEA_H
@@ -0,0 +1,79 @@
+// Pixel tables for the static navigation rings, generated at compile time.
+//
+// The rings never change, so their geometry is worked out by the compiler
+// and drawing them is a walk over these tables with the mirror images
+// applied - no trig or circle stepping at runtime.
+//
+//   CircleOctant<R>       first-octant y for each x of the midpoint circle,
+//                         the same pixels as Adafruit_GFX::drawCircle(r)
+//   RingArcTable<R, W>    one 30-60 deg arc on radii R..R-W+1, placed with the
+//                         trig_lut.h projection; the other three arcs are mirrors
+
+#ifndef RING_GEOMETRY_H
+#define RING_GEOMETRY_H
+
+#include <stdint.h>
+#include "trig_lut.h"
+
+#define RING_ARC_FIRST_DEG 30
+#define RING_ARC_LAST_DEG 60
+#define RING_ARC_POINTS (RING_ARC_LAST_DEG - RING_ARC_FIRST_DEG + 1)
+
+// Offset from the centre, x right and y up
+struct RingPoint {
+  int8_t x;
+  int8_t y;
+};
+
+// Midpoint circle walk as drawCircle() runs it: state after each x step
+constexpr int circleOctantY(int x, int y, int f, int ddFy, int target) {
+  return x == target ? y
+       : f >= 0 ? circleOctantY(x + 1, y - 1, f + ddFy + 2 + 2 * x + 3, ddFy + 2, target)
+                : circleOctantY(x + 1, y, f + 2 * x + 3, ddFy, target);
+}
+
+// Last x drawCircle() reaches before x >= y
+constexpr int circleOctantEnd(int x, int y, int f, int ddFy) {
+  return x >= y ? x
+       : f >= 0 ? circleOctantEnd(x + 1, y - 1, f + ddFy + 2 + 2 * x + 3, ddFy + 2)
+                : circleOctantEnd(x + 1, y, f + 2 * x + 3, ddFy);
+}
+
+template <int Radius, class S> struct CircleOctantTable;
+template <int Radius, int... I> struct CircleOctantTable<Radius, TrigSeq<I...> > {
+  static constexpr int8_t y[sizeof...(I)] = { (int8_t)circleOctantY(0, Radius, 1 - Radius, -2 * Radius, I)... };
+};
+template <int Radius, int... I>
+constexpr int8_t CircleOctantTable<Radius, TrigSeq<I...> >::y[sizeof...(I)];
+
+template <int Radius>
+struct CircleOctant
+    : CircleOctantTable<Radius, typename TrigMakeSeq<circleOctantEnd(0, Radius, 1 - Radius, -2 * Radius) + 1>::type> {
+  static_assert(Radius > 0 && Radius < 128, "octant table holds int8 offsets");
+};
+
+// Arc pixel on the first quadrant, matching trigPointMath()
+constexpr int8_t ringArcX(int radius, int deg) {
+  return (int8_t)(radius * (int32_t)TrigQuarterTable::q15[(90 - deg) * TRIG_STEPS_PER_DEG] / TRIG_ONE);
+}
+
+constexpr int8_t ringArcY(int radius, int deg) {
+  return (int8_t)(radius * (int32_t)TrigQuarterTable::q15[deg * TRIG_STEPS_PER_DEG] / TRIG_ONE);
+}
+
+template <int Radius, class S> struct RingArcPoints;
+template <int Radius, int... I> struct RingArcPoints<Radius, TrigSeq<I...> > {
+  static constexpr RingPoint points[sizeof...(I)] = {
+    { ringArcX(Radius - I / RING_ARC_POINTS, RING_ARC_FIRST_DEG + I % RING_ARC_POINTS),
+      ringArcY(Radius - I / RING_ARC_POINTS, RING_ARC_FIRST_DEG + I % RING_ARC_POINTS) }...
+  };
+};
+template <int Radius, int... I>
+constexpr RingPoint RingArcPoints<Radius, TrigSeq<I...> >::points[sizeof...(I)];
+
+template <int Radius, int Width>
+struct RingArcTable : RingArcPoints<Radius, typename TrigMakeSeq<Width * RING_ARC_POINTS>::type> {
+  static_assert(Radius < 128 && Width <= Radius, "arc table holds int8 offsets");
+};
+
+#endif // RING_GEOMETRY_H
@@ -1,229 +1,150 @@
+// Generated by tools/font_subset.py from fonts/tahoma10pt7b.h - do not edit.
+// Characters:  -.0123456789:BHLMNRSTWYadehimnorstuvw
+
 const uint8_t tahoma10pt7bBitmaps[] PROGMEM = {
-  0x00, 0xFF, 0xFF, 0xFC, 0x3C, 0xCF, 0x3C, 0xF3, 0xCF, 0x30, 0x04, 0x20,
-  0x21, 0x02, 0x10, 0x10, 0x87, 0xFF, 0x84, 0x20, 0x42, 0x02, 0x10, 0x10,
-  0x87, 0xFF, 0x08, 0x40, 0x42, 0x02, 0x10, 0x21, 0x01, 0x08, 0x00, 0x08,
-  0x04, 0x02, 0x07, 0xE7, 0xFE, 0x47, 0x21, 0x90, 0x7C, 0x1F, 0x82, 0xE1,
-  0x30, 0x9C, 0x5F, 0xFC, 0xFC, 0x08, 0x04, 0x02, 0x00, 0x38, 0x0C, 0x19,
-  0x06, 0x0C, 0x61, 0x83, 0x18, 0xC0, 0xC6, 0x30, 0x31, 0x98, 0x0C, 0x66,
-  0x71, 0x13, 0x32, 0x39, 0x98, 0xC0, 0x66, 0x30, 0x31, 0x8C, 0x0C, 0x63,
-  0x06, 0x18, 0xC1, 0x82, 0x20, 0xC0, 0x70, 0x1E, 0x01, 0xF8, 0x18, 0xC0,
-  0xC6, 0x06, 0x30, 0x1B, 0x00, 0x71, 0x87, 0x8C, 0x66, 0x66, 0x1B, 0x30,
-  0x71, 0x83, 0x8E, 0x1E, 0x3F, 0xB8, 0xF8, 0xE0, 0xFF, 0xF0, 0x1C, 0x63,
-  0x1C, 0x61, 0x8C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x06, 0x18, 0x70, 0xC1,
-  0x87, 0xE1, 0x83, 0x0E, 0x18, 0x60, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x31,
-  0x86, 0x38, 0xC6, 0x38, 0x08, 0x44, 0x7A, 0xE7, 0xC0, 0x81, 0xF3, 0xAF,
-  0x11, 0x08, 0x00, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF,
-  0xFF, 0xF0, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x36, 0x64, 0xCC,
-  0xFF, 0xF0, 0xFC, 0x06, 0x0C, 0x30, 0x60, 0xC1, 0x86, 0x0C, 0x18, 0x70,
-  0xC1, 0x83, 0x0C, 0x18, 0x30, 0x61, 0x83, 0x00, 0x3E, 0x3F, 0x98, 0xD8,
-  0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x33, 0xF8,
-  0xF8, 0x18, 0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
-  0x18, 0x18, 0xFF, 0xFF, 0x7C, 0x7F, 0x21, 0xC0, 0x60, 0x30, 0x18, 0x18,
-  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x07, 0xFF, 0xFE, 0x7E, 0x7F, 0xA0,
-  0xE0, 0x30, 0x18, 0x18, 0x78, 0x3E, 0x03, 0x80, 0xC0, 0x60, 0x38, 0x3F,
-  0xF9, 0xF8, 0x03, 0x01, 0xC0, 0xF0, 0x6C, 0x33, 0x0C, 0xC6, 0x33, 0x0C,
-  0xFF, 0xFF, 0xF0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x7F, 0xBF, 0xD8,
-  0x0C, 0x06, 0x03, 0x01, 0xF8, 0xFE, 0x03, 0x80, 0xC0, 0x60, 0x38, 0x37,
-  0xF9, 0xF0, 0x0F, 0x1F, 0x9C, 0x0C, 0x04, 0x06, 0xF3, 0xFD, 0x87, 0xC1,
-  0xE0, 0xF0, 0x78, 0x36, 0x33, 0xF8, 0x78, 0xFF, 0xFF, 0xC0, 0x60, 0x70,
-  0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80,
-  0x3E, 0x3F, 0xB8, 0xF8, 0x3C, 0x1F, 0x09, 0xF8, 0xFC, 0x43, 0x60, 0xF0,
-  0x78, 0x3E, 0x3B, 0xF8, 0xF8, 0x3C, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F,
-  0x07, 0xC3, 0x7F, 0x9E, 0xC0, 0x40, 0x60, 0x73, 0xF1, 0xE0, 0xFC, 0x00,
-  0xFC, 0x66, 0x60, 0x00, 0x00, 0x36, 0x64, 0xCC, 0x00, 0x40, 0x70, 0xF8,
-  0xF8, 0xF0, 0x30, 0x0F, 0x00, 0xF8, 0x0F, 0x80, 0x70, 0x04, 0xFF, 0xFF,
-  0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0, 0x80, 0x1E, 0x01, 0xF0, 0x07,
-  0xC0, 0x3E, 0x00, 0xC0, 0xF8, 0x7C, 0x7C, 0x1E, 0x02, 0x00, 0x00, 0x7C,
-  0xFE, 0x87, 0x03, 0x03, 0x03, 0x06, 0x1C, 0x30, 0x30, 0x30, 0x00, 0x00,
-  0x30, 0x30, 0x07, 0xE0, 0x18, 0x18, 0x30, 0x04, 0x20, 0x02, 0x43, 0xF2,
-  0xC6, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0x31,
-  0x86, 0x72, 0x43, 0xBE, 0x60, 0x00, 0x30, 0x00, 0x18, 0x00, 0x07, 0xF0,
-  0x06, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x19, 0x81, 0x98, 0x19, 0x83, 0x0C,
-  0x30, 0xC3, 0xFC, 0x7F, 0xE6, 0x06, 0x60, 0x6E, 0x07, 0xC0, 0x30, 0xFE,
-  0x3F, 0xEC, 0x1B, 0x06, 0xC1, 0xB0, 0xCF, 0xE3, 0xFE, 0xC1, 0xF0, 0x3C,
-  0x0F, 0x03, 0xC1, 0xFF, 0xEF, 0xE0, 0x0F, 0x87, 0xFD, 0xC1, 0xB0, 0x1E,
-  0x01, 0x80, 0x30, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x80, 0x30, 0x17, 0x06,
-  0x7F, 0xC3, 0xE0, 0xFE, 0x0F, 0xF8, 0xC1, 0xCC, 0x06, 0xC0, 0x7C, 0x03,
-  0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x6C, 0x06, 0xC1, 0xCF, 0xF8,
-  0xFE, 0x00, 0xFF, 0xFF, 0xF0, 0x18, 0x0C, 0x06, 0x03, 0xFF, 0xFF, 0xC0,
-  0x60, 0x30, 0x18, 0x0C, 0x07, 0xFF, 0xFE, 0xFF, 0xFF, 0xF0, 0x18, 0x0C,
-  0x06, 0x03, 0xFF, 0xFF, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x00,
-  0x0F, 0xC3, 0xFF, 0x38, 0x76, 0x01, 0xE0, 0x0C, 0x00, 0xC0, 0x0C, 0x1F,
-  0xC1, 0xFC, 0x03, 0xE0, 0x36, 0x03, 0x78, 0x33, 0xFF, 0x0F, 0xC0, 0xC0,
-  0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 0xC0, 0x78,
-  0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x18, 0xFF, 0xF3, 0x0C, 0x30,
-  0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x33, 0xFF, 0xC0, 0x3E, 0x7C, 0x18, 0x30,
-  0x60, 0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0xFF, 0xBE, 0x00, 0xC0, 0xF8,
-  0x3B, 0x0E, 0x63, 0x8C, 0xE1, 0xB8, 0x3E, 0x07, 0xC0, 0xDC, 0x19, 0xC3,
-  0x18, 0x61, 0x8C, 0x19, 0x83, 0xB0, 0x38, 0xC0, 0x60, 0x30, 0x18, 0x0C,
-  0x06, 0x03, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x07, 0xFF, 0xFE,
-  0xE0, 0x7E, 0x07, 0xF0, 0xFD, 0x0B, 0xD8, 0xBD, 0x9B, 0xC9, 0x3C, 0xF3,
-  0xCF, 0x3C, 0x63, 0xC6, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x30, 0xE0,
-  0xF8, 0x3F, 0x0F, 0x43, 0xD8, 0xF2, 0x3C, 0xCF, 0x33, 0xC6, 0xF1, 0xBC,
-  0x2F, 0x0F, 0xC1, 0xF0, 0x7C, 0x1C, 0x0F, 0x81, 0xFF, 0x1C, 0x1C, 0xC0,
-  0x6E, 0x03, 0xE0, 0x0F, 0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x0E,
-  0xC0, 0x67, 0x07, 0x1F, 0xF0, 0x3E, 0x00, 0xFE, 0x3F, 0xEC, 0x1F, 0x03,
-  0xC0, 0xF0, 0x3C, 0x1B, 0xFE, 0xFE, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30,
-  0x0C, 0x00, 0x0F, 0x81, 0xFF, 0x1C, 0x1C, 0xC0, 0x6E, 0x03, 0xE0, 0x0F,
-  0x00, 0x78, 0x03, 0xC0, 0x1E, 0x00, 0xF8, 0x0E, 0xC0, 0x67, 0x07, 0x1F,
-  0xF0, 0x3E, 0x00, 0x30, 0x01, 0xC0, 0x07, 0xC0, 0x1E, 0xFE, 0x1F, 0xE3,
-  0x0E, 0x60, 0xCC, 0x19, 0x83, 0x30, 0xC7, 0xF8, 0xFC, 0x19, 0xC3, 0x1C,
-  0x61, 0x8C, 0x19, 0x83, 0xB0, 0x38, 0x3F, 0x1F, 0xEE, 0x0B, 0x00, 0xC0,
-  0x38, 0x07, 0x80, 0xFC, 0x07, 0x80, 0x30, 0x0E, 0x03, 0xC1, 0xFF, 0xE3,
-  0xE0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
+  0x00, 0xFF, 0xF0, 0xFC, 0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07,
+  0x83, 0xC1, 0xE0, 0xF0, 0x78, 0x36, 0x33, 0xF8, 0xF8, 0x18, 0x18, 0xF8,
+  0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,
+  0x7C, 0x7F, 0x21, 0xC0, 0x60, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C, 0x0C,
+  0x0C, 0x0C, 0x07, 0xFF, 0xFE, 0x7E, 0x7F, 0xA0, 0xE0, 0x30, 0x18, 0x18,
+  0x78, 0x3E, 0x03, 0x80, 0xC0, 0x60, 0x38, 0x3F, 0xF9, 0xF8, 0x03, 0x01,
+  0xC0, 0xF0, 0x6C, 0x33, 0x0C, 0xC6, 0x33, 0x0C, 0xFF, 0xFF, 0xF0, 0x30,
+  0x0C, 0x03, 0x00, 0xC0, 0x30, 0x7F, 0xBF, 0xD8, 0x0C, 0x06, 0x03, 0x01,
+  0xF8, 0xFE, 0x03, 0x80, 0xC0, 0x60, 0x38, 0x37, 0xF9, 0xF0, 0x0F, 0x1F,
+  0x9C, 0x0C, 0x04, 0x06, 0xF3, 0xFD, 0x87, 0xC1, 0xE0, 0xF0, 0x78, 0x36,
+  0x33, 0xF8, 0x78, 0xFF, 0xFF, 0xC0, 0x60, 0x70, 0x30, 0x18, 0x18, 0x0C,
+  0x0C, 0x06, 0x06, 0x03, 0x03, 0x01, 0x81, 0x80, 0x3E, 0x3F, 0xB8, 0xF8,
+  0x3C, 0x1F, 0x09, 0xF8, 0xFC, 0x43, 0x60, 0xF0, 0x78, 0x3E, 0x3B, 0xF8,
+  0xF8, 0x3C, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0xC3, 0x7F, 0x9E,
+  0xC0, 0x40, 0x60, 0x73, 0xF1, 0xE0, 0xFC, 0x00, 0xFC, 0xFE, 0x3F, 0xEC,
+  0x1B, 0x06, 0xC1, 0xB0, 0xCF, 0xE3, 0xFE, 0xC1, 0xF0, 0x3C, 0x0F, 0x03,
+  0xC1, 0xFF, 0xEF, 0xE0, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80,
+  0xFF, 0xFF, 0xFF, 0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0,
+  0x18, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC0, 0x60,
+  0x30, 0x18, 0x0C, 0x07, 0xFF, 0xFE, 0xE0, 0x7E, 0x07, 0xF0, 0xFD, 0x0B,
+  0xD8, 0xBD, 0x9B, 0xC9, 0x3C, 0xF3, 0xCF, 0x3C, 0x63, 0xC6, 0x3C, 0x03,
+  0xC0, 0x3C, 0x03, 0xC0, 0x30, 0xE0, 0xF8, 0x3F, 0x0F, 0x43, 0xD8, 0xF2,
+  0x3C, 0xCF, 0x33, 0xC6, 0xF1, 0xBC, 0x2F, 0x0F, 0xC1, 0xF0, 0x7C, 0x1C,
+  0xFE, 0x1F, 0xE3, 0x0E, 0x60, 0xCC, 0x19, 0x83, 0x30, 0xC7, 0xF8, 0xFC,
+  0x19, 0xC3, 0x1C, 0x61, 0x8C, 0x19, 0x83, 0xB0, 0x38, 0x3F, 0x1F, 0xEE,
+  0x0B, 0x00, 0xC0, 0x38, 0x07, 0x80, 0xFC, 0x07, 0x80, 0x30, 0x0E, 0x03,
+  0xC1, 0xFF, 0xE3, 0xE0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x60, 0x06, 0x00,
   0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00,
-  0xC0, 0x78, 0x0F, 0x01, 0xE0, 0x3C, 0x07, 0x80, 0xF0, 0x1E, 0x03, 0xC0,
-  0x78, 0x0F, 0x01, 0xE0, 0x36, 0x0C, 0xFF, 0x87, 0xC0, 0xC0, 0x7C, 0x1D,
-  0x83, 0x30, 0x66, 0x0C, 0x63, 0x0C, 0x61, 0x8C, 0x1B, 0x03, 0x60, 0x6C,
-  0x0D, 0x80, 0xE0, 0x1C, 0x03, 0x80, 0xC1, 0xC1, 0xE0, 0xE0, 0xD8, 0x70,
-  0xCC, 0x28, 0x66, 0x16, 0x33, 0x1B, 0x18, 0xCD, 0x98, 0x64, 0x4C, 0x32,
-  0x26, 0x1B, 0x1B, 0x05, 0x8D, 0x83, 0xC7, 0x81, 0xC1, 0xC0, 0xE0, 0xE0,
-  0x70, 0x70, 0xC0, 0x6C, 0x19, 0xC7, 0x18, 0xC1, 0xB0, 0x36, 0x03, 0x80,
-  0x70, 0x0E, 0x03, 0x60, 0x6C, 0x18, 0xC7, 0x1C, 0xC1, 0xB0, 0x18, 0xE0,
+  0x60, 0x06, 0x00, 0xC1, 0xC1, 0xE0, 0xE0, 0xD8, 0x70, 0xCC, 0x28, 0x66,
+  0x16, 0x33, 0x1B, 0x18, 0xCD, 0x98, 0x64, 0x4C, 0x32, 0x26, 0x1B, 0x1B,
+  0x05, 0x8D, 0x83, 0xC7, 0x81, 0xC1, 0xC0, 0xE0, 0xE0, 0x70, 0x70, 0xE0,
   0x76, 0x06, 0x70, 0xE3, 0x0C, 0x19, 0x81, 0xB8, 0x0F, 0x00, 0xF0, 0x06,
-  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0xFF, 0xFF,
-  0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x0C,
-  0x07, 0xFF, 0xFE, 0xFE, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63,
-  0x18, 0xC6, 0x31, 0xF0, 0xC1, 0x81, 0x83, 0x06, 0x0C, 0x0C, 0x18, 0x30,
-  0x70, 0x60, 0xC1, 0x81, 0x83, 0x06, 0x0C, 0x0C, 0x18, 0xF8, 0xC6, 0x31,
-  0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC7, 0xF0, 0x06, 0x00,
-  0xF0, 0x0F, 0x01, 0x98, 0x30, 0xC3, 0x0C, 0x60, 0x6C, 0x03, 0xFF, 0xE0,
-  0xE6, 0x23, 0x7E, 0x3F, 0x80, 0x60, 0x31, 0xFB, 0xFF, 0x87, 0x83, 0xC3,
-  0xFF, 0xCF, 0x60, 0xC0, 0x60, 0x30, 0x18, 0x0C, 0x06, 0xF3, 0xFD, 0xC7,
-  0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1E, 0x1B, 0xFD, 0xBC, 0x1E, 0x7F, 0x61,
-  0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x61, 0x7F, 0x1E, 0x01, 0x80, 0xC0, 0x60,
-  0x30, 0x18, 0xFD, 0xFE, 0xC3, 0xC1, 0xE0, 0xF0, 0x78, 0x3C, 0x1F, 0x1D,
-  0xFE, 0x7B, 0x1F, 0x1F, 0xE6, 0x1F, 0x03, 0xFF, 0xFF, 0xFC, 0x03, 0x00,
-  0x60, 0x5F, 0xF1, 0xF8, 0x1E, 0x7D, 0xC3, 0x06, 0x1F, 0xBF, 0x30, 0x60,
-  0xC1, 0x83, 0x06, 0x0C, 0x18, 0x30, 0x1F, 0xBF, 0xD8, 0x78, 0x3C, 0x1E,
-  0x0F, 0x07, 0x83, 0xE1, 0xBF, 0xCF, 0x60, 0x30, 0x3B, 0xF9, 0xF8, 0xC0,
-  0xC0, 0xC0, 0xC0, 0xC0, 0xDE, 0xFE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
-  0xC3, 0xC3, 0xC3, 0xF0, 0xFF, 0xFF, 0xFC, 0x18, 0xC0, 0x07, 0xBC, 0x63,
-  0x18, 0xC6, 0x31, 0x8C, 0x63, 0x1F, 0xB8, 0xC0, 0x60, 0x30, 0x18, 0x0C,
-  0x06, 0x1B, 0x19, 0x98, 0xD8, 0x78, 0x3E, 0x1B, 0x0C, 0xC6, 0x33, 0x1D,
-  0x87, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0x7B, 0xFB, 0xFE, 0x38, 0xF0, 0xC3,
-  0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30,
-  0xC0, 0xDE, 0xFE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
-  0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x9F,
-  0xE1, 0xE0, 0xDE, 0x7F, 0xB8, 0xF8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC3,
-  0x7F, 0xBF, 0x98, 0x0C, 0x06, 0x03, 0x00, 0x3F, 0xBF, 0xD8, 0x78, 0x3C,
-  0x1E, 0x0F, 0x07, 0x83, 0xE3, 0xBF, 0xCF, 0x60, 0x30, 0x18, 0x0C, 0x06,
+  0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x7E, 0x3F,
+  0x80, 0x60, 0x31, 0xFB, 0xFF, 0x87, 0x83, 0xC3, 0xFF, 0xCF, 0x60, 0x01,
+  0x80, 0xC0, 0x60, 0x30, 0x18, 0xFD, 0xFE, 0xC3, 0xC1, 0xE0, 0xF0, 0x78,
+  0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x1F, 0x1F, 0xE6, 0x1F, 0x03, 0xFF, 0xFF,
+  0xFC, 0x03, 0x00, 0x60, 0x5F, 0xF1, 0xF8, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+  0xDE, 0xFE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xF0,
+  0xFF, 0xFF, 0xFC, 0xDE, 0x7B, 0xFB, 0xFE, 0x38, 0xF0, 0xC3, 0xC3, 0x0F,
+  0x0C, 0x3C, 0x30, 0xF0, 0xC3, 0xC3, 0x0F, 0x0C, 0x3C, 0x30, 0xC0, 0xDE,
+  0xFE, 0xE3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0x1E, 0x1F,
+  0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0x61, 0x9F, 0xE1, 0xE0,
   0xCF, 0xFE, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x00, 0x3E, 0x7F, 0xC1,
   0xC0, 0xF0, 0x7E, 0x1F, 0x03, 0x83, 0xFE, 0x7C, 0x60, 0xC1, 0x87, 0xFF,
   0xEC, 0x18, 0x30, 0x60, 0xC1, 0x83, 0x07, 0xE7, 0xC0, 0xC3, 0xC3, 0xC3,
   0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC7, 0x7F, 0x3B, 0xC1, 0xB1, 0x98, 0xCC,
   0x63, 0x61, 0xB0, 0xD8, 0x38, 0x1C, 0x0E, 0x02, 0x00, 0xC3, 0x0F, 0x0C,
   0x36, 0x39, 0x99, 0xE6, 0x64, 0x99, 0x92, 0x62, 0xCD, 0x0E, 0x14, 0x38,
-  0x70, 0xE1, 0xC1, 0x86, 0x00, 0xC1, 0xB1, 0x8D, 0x86, 0xC1, 0xC0, 0xE0,
-  0x70, 0x6C, 0x36, 0x31, 0xB0, 0x60, 0xC1, 0xB1, 0x98, 0xCC, 0x63, 0x61,
-  0xB0, 0xD8, 0x38, 0x1C, 0x0E, 0x06, 0x03, 0x03, 0x81, 0x80, 0xC0, 0xFF,
-  0xFF, 0x06, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0xFF, 0xFF, 0x07, 0x0C,
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0xC0, 0x30, 0x10, 0x18, 0x18,
-  0x18, 0x18, 0x18, 0x18, 0x0C, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
-  0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x0C, 0x03, 0x0C, 0x08, 0x18,
-  0x18, 0x18, 0x18, 0x18, 0x18, 0x30, 0xE0, 0x3C, 0x1B, 0xF0, 0xF9, 0xCF,
-  0x87, 0xEC, 0x1E, 0x00 };
+  0x70, 0xE1, 0xC1, 0x86, 0x00 };
 
-const GFXglyph tahoma10pt7bGlyphs[] PROGMEM = {
+constexpr GFXglyph tahoma10pt7bGlyphs[] PROGMEM = {
   {     0,   1,   1,   6,    0,    0 },   // 0x20 ' '
-  {     1,   2,  15,   7,    2,  -14 },   // 0x21 '!'
-  {     5,   6,   6,   8,    1,  -15 },   // 0x22 '"'
-  {    10,  13,  15,  15,    1,  -14 },   // 0x23 '#'
-  {    35,   9,  19,  11,    1,  -15 },   // 0x24 '$'
-  {    57,  18,  15,  20,    1,  -14 },   // 0x25 '%'
-  {    91,  13,  15,  13,    0,  -14 },   // 0x26 '&'
-  {   116,   2,   6,   4,    1,  -15 },   // 0x27 '''
-  {   118,   6,  20,   8,    1,  -15 },   // 0x28 '('
-  {   133,   6,  20,   8,    1,  -15 },   // 0x29 ')'
-  {   148,   9,   9,  11,    1,  -15 },   // 0x2A '*'
-  {   159,  12,  12,  15,    1,  -11 },   // 0x2B '+'
-  {   177,   4,   6,   6,    1,   -2 },   // 0x2C ','
-  {   180,   6,   2,   7,    1,   -6 },   // 0x2D '-'
-  {   182,   2,   3,   6,    2,   -2 },   // 0x2E '.'
-  {   183,   7,  19,   8,    0,  -15 },   // 0x2F '/'
-  {   200,   9,  15,  11,    1,  -14 },   // 0x30 '0'
-  {   217,   8,  15,  11,    2,  -14 },   // 0x31 '1'
-  {   232,   9,  15,  11,    1,  -14 },   // 0x32 '2'
-  {   249,   9,  15,  11,    1,  -14 },   // 0x33 '3'
-  {   266,  10,  15,  11,    0,  -14 },   // 0x34 '4'
-  {   285,   9,  15,  11,    1,  -14 },   // 0x35 '5'
-  {   302,   9,  15,  11,    1,  -14 },   // 0x36 '6'
-  {   319,   9,  15,  11,    1,  -14 },   // 0x37 '7'
-  {   336,   9,  15,  11,    1,  -14 },   // 0x38 '8'
-  {   353,   9,  15,  11,    1,  -14 },   // 0x39 '9'
-  {   370,   2,  11,   7,    2,  -10 },   // 0x3A ':'
-  {   373,   4,  14,   7,    1,  -10 },   // 0x3B ';'
-  {   380,  10,  11,  15,    2,  -11 },   // 0x3C '<'
-  {   394,  11,   6,  15,    2,   -8 },   // 0x3D '='
-  {   403,  11,  11,  15,    2,  -11 },   // 0x3E '>'
-  {   419,   8,  15,   9,    1,  -14 },   // 0x3F '?'
-  {   434,  16,  17,  18,    1,  -14 },   // 0x40 '@'
-  {   468,  12,  15,  12,    0,  -14 },   // 0x41 'A'
-  {   491,  10,  15,  12,    1,  -14 },   // 0x42 'B'
-  {   510,  11,  15,  12,    0,  -14 },   // 0x43 'C'
-  {   531,  12,  15,  14,    1,  -14 },   // 0x44 'D'
-  {   554,   9,  15,  11,    1,  -14 },   // 0x45 'E'
-  {   571,   9,  15,  10,    1,  -14 },   // 0x46 'F'
-  {   588,  12,  15,  13,    0,  -14 },   // 0x47 'G'
-  {   611,  11,  15,  14,    1,  -14 },   // 0x48 'H'
-  {   632,   6,  15,   7,    0,  -14 },   // 0x49 'I'
-  {   644,   7,  15,   8,    0,  -14 },   // 0x4A 'J'
-  {   658,  11,  15,  12,    1,  -14 },   // 0x4B 'K'
-  {   679,   9,  15,  10,    1,  -14 },   // 0x4C 'L'
-  {   696,  12,  15,  15,    1,  -14 },   // 0x4D 'M'
-  {   719,  10,  15,  13,    1,  -14 },   // 0x4E 'N'
-  {   738,  13,  15,  14,    0,  -14 },   // 0x4F 'O'
-  {   763,  10,  15,  11,    1,  -14 },   // 0x50 'P'
-  {   782,  13,  19,  14,    0,  -14 },   // 0x51 'Q'
-  {   813,  11,  15,  12,    1,  -14 },   // 0x52 'R'
-  {   834,  10,  15,  11,    0,  -14 },   // 0x53 'S'
-  {   853,  12,  15,  12,    0,  -14 },   // 0x54 'T'
-  {   876,  11,  15,  13,    1,  -14 },   // 0x55 'U'
-  {   897,  11,  15,  12,    0,  -14 },   // 0x56 'V'
-  {   918,  17,  15,  18,    0,  -14 },   // 0x57 'W'
-  {   950,  11,  15,  12,    0,  -14 },   // 0x58 'X'
-  {   971,  12,  15,  12,    0,  -14 },   // 0x59 'Y'
-  {   994,   9,  15,  11,    1,  -14 },   // 0x5A 'Z'
-  {  1011,   5,  20,   8,    2,  -15 },   // 0x5B '['
-  {  1024,   7,  19,   8,    1,  -15 },   // 0x5C '\'
-  {  1041,   5,  20,   8,    1,  -15 },   // 0x5D ']'
-  {  1054,  12,   8,  15,    1,  -14 },   // 0x5E '^'
-  {  1066,  11,   1,  11,    0,    3 },   // 0x5F '_'
-  {  1068,   4,   4,  11,    2,  -16 },   // 0x60 '`'
-  {  1070,   9,  11,  11,    0,  -10 },   // 0x61 'a'
-  {  1083,   9,  16,  11,    1,  -15 },   // 0x62 'b'
-  {  1101,   8,  11,   9,    0,  -10 },   // 0x63 'c'
-  {  1112,   9,  16,  11,    0,  -15 },   // 0x64 'd'
-  {  1130,  10,  11,  11,    0,  -10 },   // 0x65 'e'
-  {  1144,   7,  16,   6,    1,  -15 },   // 0x66 'f'
-  {  1158,   9,  15,  11,    0,  -10 },   // 0x67 'g'
-  {  1175,   8,  16,  11,    1,  -15 },   // 0x68 'h'
-  {  1191,   2,  15,   5,    1,  -14 },   // 0x69 'i'
-  {  1195,   5,  19,   6,   -1,  -14 },   // 0x6A 'j'
-  {  1207,   9,  16,  10,    1,  -15 },   // 0x6B 'k'
-  {  1225,   2,  16,   5,    1,  -15 },   // 0x6C 'l'
-  {  1229,  14,  11,  17,    1,  -10 },   // 0x6D 'm'
-  {  1249,   8,  11,  11,    1,  -10 },   // 0x6E 'n'
-  {  1260,  10,  11,  11,    0,  -10 },   // 0x6F 'o'
-  {  1274,   9,  15,  11,    1,  -10 },   // 0x70 'p'
-  {  1291,   9,  15,  11,    0,  -10 },   // 0x71 'q'
-  {  1308,   6,  11,   7,    1,  -10 },   // 0x72 'r'
-  {  1317,   8,  11,   9,    0,  -10 },   // 0x73 's'
-  {  1328,   7,  14,   7,    0,  -13 },   // 0x74 't'
-  {  1341,   8,  11,  11,    1,  -10 },   // 0x75 'u'
-  {  1352,   9,  11,  10,    0,  -10 },   // 0x76 'v'
-  {  1365,  14,  11,  15,    0,  -10 },   // 0x77 'w'
-  {  1385,   9,  11,  10,    0,  -10 },   // 0x78 'x'
-  {  1398,   9,  15,  10,    0,  -10 },   // 0x79 'y'
-  {  1415,   8,  11,   9,    0,  -10 },   // 0x7A 'z'
-  {  1426,   8,  20,  10,    1,  -15 },   // 0x7B '{'
-  {  1446,   2,  20,   8,    3,  -15 },   // 0x7C '|'
-  {  1451,   8,  20,  10,    1,  -15 },   // 0x7D '}'
-  {  1471,  13,   5,  15,    1,   -8 } }; // 0x7E '~'
+  {     0,   0,   0,   0,    0,    0 },   // 0x21 '!' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x22 '"' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x23 '#' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x24 '$' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x25 '%' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x26 '&' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x27 ''' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x28 '(' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x29 ')' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x2A '*' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x2B '+' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x2C ',' (not used)
+  {     1,   6,   2,   7,    1,   -6 },   // 0x2D '-'
+  {     3,   2,   3,   6,    2,   -2 },   // 0x2E '.'
+  {     0,   0,   0,   0,    0,    0 },   // 0x2F '/' (not used)
+  {     4,   9,  15,  11,    1,  -14 },   // 0x30 '0'
+  {    21,   8,  15,  11,    2,  -14 },   // 0x31 '1'
+  {    36,   9,  15,  11,    1,  -14 },   // 0x32 '2'
+  {    53,   9,  15,  11,    1,  -14 },   // 0x33 '3'
+  {    70,  10,  15,  11,    0,  -14 },   // 0x34 '4'
+  {    89,   9,  15,  11,    1,  -14 },   // 0x35 '5'
+  {   106,   9,  15,  11,    1,  -14 },   // 0x36 '6'
+  {   123,   9,  15,  11,    1,  -14 },   // 0x37 '7'
+  {   140,   9,  15,  11,    1,  -14 },   // 0x38 '8'
+  {   157,   9,  15,  11,    1,  -14 },   // 0x39 '9'
+  {   174,   2,  11,   7,    2,  -10 },   // 0x3A ':'
+  {     0,   0,   0,   0,    0,    0 },   // 0x3B ';' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x3C '<' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x3D '=' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x3E '>' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x3F '?' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x40 '@' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x41 'A' (not used)
+  {   177,  10,  15,  12,    1,  -14 },   // 0x42 'B'
+  {     0,   0,   0,   0,    0,    0 },   // 0x43 'C' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x44 'D' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x45 'E' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x46 'F' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x47 'G' (not used)
+  {   196,  11,  15,  14,    1,  -14 },   // 0x48 'H'
+  {     0,   0,   0,   0,    0,    0 },   // 0x49 'I' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x4A 'J' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x4B 'K' (not used)
+  {   217,   9,  15,  10,    1,  -14 },   // 0x4C 'L'
+  {   234,  12,  15,  15,    1,  -14 },   // 0x4D 'M'
+  {   257,  10,  15,  13,    1,  -14 },   // 0x4E 'N'
+  {     0,   0,   0,   0,    0,    0 },   // 0x4F 'O' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x50 'P' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x51 'Q' (not used)
+  {   276,  11,  15,  12,    1,  -14 },   // 0x52 'R'
+  {   297,  10,  15,  11,    0,  -14 },   // 0x53 'S'
+  {   316,  12,  15,  12,    0,  -14 },   // 0x54 'T'
+  {     0,   0,   0,   0,    0,    0 },   // 0x55 'U' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x56 'V' (not used)
+  {   339,  17,  15,  18,    0,  -14 },   // 0x57 'W'
+  {     0,   0,   0,   0,    0,    0 },   // 0x58 'X' (not used)
+  {   371,  12,  15,  12,    0,  -14 },   // 0x59 'Y'
+  {     0,   0,   0,   0,    0,    0 },   // 0x5A 'Z' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x5B '[' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x5C '\' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x5D ']' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x5E '^' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x5F '_' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x60 '`' (not used)
+  {   394,   9,  11,  11,    0,  -10 },   // 0x61 'a'
+  {     0,   0,   0,   0,    0,    0 },   // 0x62 'b' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x63 'c' (not used)
+  {   407,   9,  16,  11,    0,  -15 },   // 0x64 'd'
+  {   425,  10,  11,  11,    0,  -10 },   // 0x65 'e'
+  {     0,   0,   0,   0,    0,    0 },   // 0x66 'f' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x67 'g' (not used)
+  {   439,   8,  16,  11,    1,  -15 },   // 0x68 'h'
+  {   455,   2,  15,   5,    1,  -14 },   // 0x69 'i'
+  {     0,   0,   0,   0,    0,    0 },   // 0x6A 'j' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x6B 'k' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x6C 'l' (not used)
+  {   459,  14,  11,  17,    1,  -10 },   // 0x6D 'm'
+  {   479,   8,  11,  11,    1,  -10 },   // 0x6E 'n'
+  {   490,  10,  11,  11,    0,  -10 },   // 0x6F 'o'
+  {     0,   0,   0,   0,    0,    0 },   // 0x70 'p' (not used)
+  {     0,   0,   0,   0,    0,    0 },   // 0x71 'q' (not used)
+  {   504,   6,  11,   7,    1,  -10 },   // 0x72 'r'
+  {   513,   8,  11,   9,    0,  -10 },   // 0x73 's'
+  {   524,   7,  14,   7,    0,  -13 },   // 0x74 't'
+  {   537,   8,  11,  11,    1,  -10 },   // 0x75 'u'
+  {   548,   9,  11,  10,    0,  -10 },   // 0x76 'v'
+  {   561,  14,  11,  15,    0,  -10 } }; // 0x77 'w'
 
-const GFXfont tahoma10pt7b PROGMEM = {
+constexpr GFXfont tahoma10pt7b PROGMEM = {
   (uint8_t  *)tahoma10pt7bBitmaps,
   (GFXglyph *)tahoma10pt7bGlyphs,
-  0x20, 0x7E, 24 };
+  0x20, 0x77, 24 };
 
-// Approx. 2152 bytes
+// Approx. 1204 bytes
@@ -0,0 +1,105 @@
+// String metrics straight from the GFXfont glyph tables.
+//
+// textBounds() returns the same box as Adafruit_GFX::getTextBounds(text, 0,
+// 0, ...) for one line at text size 1 (no wrapping). It is a single pass over
+// the glyph table: the cursor is the running sum of xAdvance, and the ink box
+// is the glyph offsets and sizes placed at that cursor. getTextBounds() takes
+// the same path through the GFX text engine, one virtual call and wrap check
+// per character.
+//
+// The Tahoma font tables are constexpr, so textBoundsOf() / textAdvance()
+// fold to constants for fixed strings. Include after Adafruit_GFX.h, like the
+// font headers.
+
+#ifndef TEXT_METRICS_H
+#define TEXT_METRICS_H
+
+#include <stdint.h>
+
+#define TEXT_NO_MIN 0x7FFF   // Empty-box sentinels, as in getTextBounds()
+#define TEXT_NO_MAX -1
+
+struct TextBounds {
+  int16_t x;     // Ink box relative to the cursor
+  int16_t y;
+  uint16_t w;
+  uint16_t h;
+};
+
+constexpr bool textHasGlyph(const GFXfont &font, char c) {
+  return (uint8_t)c >= font.first && (uint8_t)c <= font.last;
+}
+
+constexpr const GFXglyph &textGlyph(const GFXfont &font, char c) {
+  return font.glyph[(uint8_t)c - font.first];
+}
+
+constexpr int textMin(int a, int b) {
+  return a < b ? a : b;
+}
+
+constexpr int textMax(int a, int b) {
+  return a > b ? a : b;
+}
+
+constexpr TextBounds textBoundsFromBox(int minX, int minY, int maxX, int maxY) {
+  return TextBounds{ (int16_t)(maxX >= minX ? minX : 0), (int16_t)(maxY >= minY ? minY : 0),
+                     (uint16_t)(maxX >= minX ? maxX - minX + 1 : 0),
+                     (uint16_t)(maxY >= minY ? maxY - minY + 1 : 0) };
+}
+
+// Cursor advance of the whole string: a sum over the xAdvance table
+constexpr int textAdvance(const GFXfont &font, const char *s) {
+  return *s == 0 ? 0 : (textHasGlyph(font, *s) ? textGlyph(font, *s).xAdvance : 0) + textAdvance(font, s + 1);
+}
+
+// Compile-time ink box edges, one recursion per edge to stay within C++11 constexpr
+constexpr int textLeft(const GFXfont &font, const char *s, int x) {
+  return *s == 0 ? TEXT_NO_MIN
+       : !textHasGlyph(font, *s) ? textLeft(font, s + 1, x)
+       : textMin(x + textGlyph(font, *s).xOffset, textLeft(font, s + 1, x + textGlyph(font, *s).xAdvance));
+}
+
+constexpr int textRight(const GFXfont &font, const char *s, int x) {
+  return *s == 0 ? TEXT_NO_MAX
+       : !textHasGlyph(font, *s) ? textRight(font, s + 1, x)
+       : textMax(x + textGlyph(font, *s).xOffset + textGlyph(font, *s).width - 1,
+                 textRight(font, s + 1, x + textGlyph(font, *s).xAdvance));
+}
+
+constexpr int textTop(const GFXfont &font, const char *s) {
+  return *s == 0 ? TEXT_NO_MIN
+       : !textHasGlyph(font, *s) ? textTop(font, s + 1)
+       : textMin(textGlyph(font, *s).yOffset, textTop(font, s + 1));
+}
+
+constexpr int textBottom(const GFXfont &font, const char *s) {
+  return *s == 0 ? TEXT_NO_MAX
+       : !textHasGlyph(font, *s) ? textBottom(font, s + 1)
+       : textMax(textGlyph(font, *s).yOffset + textGlyph(font, *s).height - 1, textBottom(font, s + 1));
+}
+
+constexpr TextBounds textBoundsOf(const GFXfont &font, const char *s) {
+  return textBoundsFromBox(textLeft(font, s, 0), textTop(font, s), textRight(font, s, 0), textBottom(font, s));
+}
+
+// Runtime form for any font, including the library FreeMono tables
+inline TextBounds textBounds(const GFXfont *font, const char *s) {
+  int x = 0;
+  int minX = TEXT_NO_MIN, minY = TEXT_NO_MIN, maxX = TEXT_NO_MAX, maxY = TEXT_NO_MAX;
+  for (; *s; s++) {
+    if (!textHasGlyph(*font, *s)) continue;
+    const GFXglyph &g = textGlyph(*font, *s);
+    int x1 = x + g.xOffset;
+    int x2 = x1 + g.width - 1;
+    int y2 = g.yOffset + g.height - 1;
+    if (x1 < minX) minX = x1;
+    if (x2 > maxX) maxX = x2;
+    if (g.yOffset < minY) minY = g.yOffset;
+    if (y2 > maxY) maxY = y2;
+    x += g.xAdvance;
+  }
+  return textBoundsFromBox(minX, minY, maxX, maxY);
+}
+
+#endif // TEXT_METRICS_H
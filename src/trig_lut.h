@@ -0,0 +1,103 @@
+// Integer sine/cosine for drawing.
+//
+// Angles are int32 in 1/8 degree steps (any value, wrapped per turn). Results
+// are Q15 (1.0 = 32768) from a quarter-wave table generated at compile time,
+// so no float trig runs while a frame is built. trigScale() truncates towards
+// zero like the int() casts the drawing code used with sin()/cos(), so whole-
+// degree geometry lands on the same pixels (tools/trig_lut_check.cpp).
+//
+// Kept to C++11 so it builds with the Arduino-ESP32 toolchain defaults.
+
+#ifndef TRIG_LUT_H
+#define TRIG_LUT_H
+
+#include <stdint.h>
+
+#define TRIG_STEPS_PER_DEG 8
+#define TRIG_QUARTER (90 * TRIG_STEPS_PER_DEG)
+#define TRIG_STEPS_PER_TURN (4 * TRIG_QUARTER)
+#define TRIG_ONE 32768                   // Q15 1.0
+
+// sin(x) for 0 <= x <= pi/2 by Taylor series, usable in constant expressions
+constexpr double trigSinSeries(double x2, double term, double sum, int n) {
+  return n > 12 ? sum : trigSinSeries(x2, -term * x2 / ((2 * n) * (2 * n + 1)), sum + term, n + 1);
+}
+
+constexpr uint16_t trigQuarterQ15(int step) {
+  return (uint16_t)(trigSinSeries((step * (3.14159265358979323846 / 2 / TRIG_QUARTER)) *
+                                  (step * (3.14159265358979323846 / 2 / TRIG_QUARTER)),
+                                  step * (3.14159265358979323846 / 2 / TRIG_QUARTER), 0.0, 1) *
+                    TRIG_ONE + 0.5);
+}
+
+// 0..N-1 as a parameter pack, log-depth so 721 entries stay inside the template depth limit
+template <int... I> struct TrigSeq { typedef TrigSeq type; };
+template <class A, class B> struct TrigConcat;
+template <int... A, int... B>
+struct TrigConcat<TrigSeq<A...>, TrigSeq<B...> > : TrigSeq<A..., (int)sizeof...(A) + B...> {};
+template <int N>
+struct TrigMakeSeq : TrigConcat<typename TrigMakeSeq<N / 2>::type, typename TrigMakeSeq<N - N / 2>::type> {};
+template <> struct TrigMakeSeq<0> : TrigSeq<> {};
+template <> struct TrigMakeSeq<1> : TrigSeq<0> {};
+
+template <class S> struct TrigTable;
+template <int... I> struct TrigTable<TrigSeq<I...> > {
+  static constexpr uint16_t q15[sizeof...(I)] = { trigQuarterQ15(I)... };
+};
+template <int... I> constexpr uint16_t TrigTable<TrigSeq<I...> >::q15[sizeof...(I)];
+
+// sin(0..90 deg) in Q15, TRIG_QUARTER + 1 entries
+typedef TrigTable<TrigMakeSeq<TRIG_QUARTER + 1>::type> TrigQuarterTable;
+
+static_assert(TrigQuarterTable::q15[0] == 0, "sin(0) must be exact");
+static_assert(TrigQuarterTable::q15[TRIG_QUARTER] == TRIG_ONE, "sin(90) must be exact");
+static_assert(TrigQuarterTable::q15[30 * TRIG_STEPS_PER_DEG] == TRIG_ONE / 2, "sin(30) must be exact");
+
+inline int32_t trigSinQ15(int32_t angle) {
+  angle %= TRIG_STEPS_PER_TURN;
+  if (angle < 0) angle += TRIG_STEPS_PER_TURN;
+  if (angle <= TRIG_QUARTER) return TrigQuarterTable::q15[angle];
+  if (angle <= 2 * TRIG_QUARTER) return TrigQuarterTable::q15[2 * TRIG_QUARTER - angle];
+  if (angle <= 3 * TRIG_QUARTER) return -(int32_t)TrigQuarterTable::q15[angle - 2 * TRIG_QUARTER];
+  return -(int32_t)TrigQuarterTable::q15[4 * TRIG_QUARTER - angle];
+}
+
+inline int32_t trigCosQ15(int32_t angle) {
+  return trigSinQ15(angle + TRIG_QUARTER);
+}
+
+// Whole degrees to steps
+inline int32_t trigAngle(int degrees) {
+  return degrees * TRIG_STEPS_PER_DEG;
+}
+
+// Fractional degrees (bearings, headings) to the nearest step
+inline int32_t trigAngle(float degrees) {
+  float steps = degrees * TRIG_STEPS_PER_DEG;
+  return (int32_t)(steps < 0.0f ? steps - 0.5f : steps + 0.5f);
+}
+
+// length * q15, truncated towards zero like int(length * sin(a))
+inline int trigScale(int length, int32_t q15) {
+  return (int)((length * q15) / TRIG_ONE);
+}
+
+// Point at a compass bearing: 0 = up, clockwise (ring icons)
+inline void trigPointBearing(int cx, int cy, int radius, int32_t angle, int &x, int &y) {
+  x = cx + trigScale(radius, trigSinQ15(angle));
+  y = cy - trigScale(radius, trigCosQ15(angle));
+}
+
+// Point at a maths angle: 0 = right, counter-clockwise (ring arcs, GPS wait dot)
+inline void trigPointMath(int cx, int cy, int radius, int32_t angle, int &x, int &y) {
+  x = cx + trigScale(radius, trigCosQ15(angle));
+  y = cy - trigScale(radius, trigSinQ15(angle));
+}
+
+// Point at a screen angle: 0 = right, clockwise since y grows downwards (compass rose)
+inline void trigPointScreen(int cx, int cy, int radius, int32_t angle, int &x, int &y) {
+  x = cx + trigScale(radius, trigCosQ15(angle));
+  y = cy + trigScale(radius, trigSinQ15(angle));
+}
+
+#endif // TRIG_LUT_H
@@ -0,0 +1,166 @@
+// u-blox UBX framing and NAV-PVT decoding.
+//
+// ubxEncode() takes the receiver's byte stream one byte at a time, checks the
+// Fletcher-8 checksum of every frame and buffers only NAV-PVT payloads; other
+// messages are checksummed and skipped. fillFixFromNavPVT() reads the fields
+// the navigation code needs straight out of that buffer. No Arduino
+// dependencies - tools/ubx_check.cpp runs reference frames through the same code.
+
+#ifndef UBX_H
+#define UBX_H
+
+#include <stdint.h>
+#include "gps_fix.h"
+
+// UBX protocol constants
+#define UBX_SYNC1 0xB5
+#define UBX_SYNC2 0x62
+#define UBX_CLASS_NAV 0x01
+#define UBX_CLASS_CFG 0x06
+#define UBX_CLASS_MGA 0x13
+#define UBX_CLASS_NMEA 0xF0
+#define UBX_ID_NAV_PVT 0x07
+#define UBX_ID_CFG_MSG 0x01
+#define UBX_ID_CFG_PRT 0x00
+#define UBX_ID_CFG_RATE 0x08
+#define UBX_ID_CFG_RXM 0x11
+#define UBX_ID_CFG_PM2 0x3B
+#define UBX_ID_MGA_INI 0x40
+#define UBX_NAV_PVT_LEN 92
+#define UBX_MAX_PAYLOAD 1024   // Longer is a corrupt length field (NAV-SAT tops out near 730) - resync
+
+// UBX frame parser - only NAV-PVT payloads are buffered, other messages are checksummed and skipped
+enum UBXParseState {
+  UBX_WAIT_SYNC1,
+  UBX_WAIT_SYNC2,
+  UBX_READ_CLASS,
+  UBX_READ_ID,
+  UBX_READ_LEN1,
+  UBX_READ_LEN2,
+  UBX_READ_PAYLOAD,
+  UBX_READ_CK_A,
+  UBX_READ_CK_B
+};
+
+struct UBXParser {
+  UBXParseState state;
+  uint8_t msgClass;
+  uint8_t msgId;
+  uint16_t length;
+  uint16_t index;
+  uint8_t ckA;
+  uint8_t ckB;
+  bool keepPayload;
+  uint8_t payload[UBX_NAV_PVT_LEN];
+  volatile uint32_t badChecksum;   // Frames dropped on either checksum byte
+};
+
+// Little-endian field readers for UBX payloads (read in place, no struct copy)
+static inline uint16_t ubxU16(const uint8_t *p) {
+  return (uint16_t)p[0] | ((uint16_t)p[1] << 8);
+}
+
+static inline int32_t ubxI32(const uint8_t *p) {
+  return (int32_t)((uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24));
+}
+
+// Feed one byte to the UBX framer; returns true when a NAV-PVT frame with a valid checksum completes
+inline bool ubxEncode(UBXParser &ubx, uint8_t c) {
+  switch (ubx.state) {
+    case UBX_WAIT_SYNC1:
+      if (c == UBX_SYNC1) ubx.state = UBX_WAIT_SYNC2;
+      return false;
+    case UBX_WAIT_SYNC2:
+      ubx.state = (c == UBX_SYNC2) ? UBX_READ_CLASS : UBX_WAIT_SYNC1;
+      return false;
+    case UBX_READ_CLASS:
+      ubx.msgClass = c;
+      ubx.ckA = c;
+      ubx.ckB = c;
+      ubx.state = UBX_READ_ID;
+      return false;
+    case UBX_READ_ID:
+      ubx.msgId = c;
+      break;
+    case UBX_READ_LEN1:
+      ubx.length = c;
+      break;
+    case UBX_READ_LEN2:
+      ubx.length |= (uint16_t)c << 8;
+      if (ubx.length > UBX_MAX_PAYLOAD) {
+        // Don't swallow up to 64 KB of good frames as the payload of a broken one
+        ubx.state = UBX_WAIT_SYNC1;
+        return false;
+      }
+      ubx.index = 0;
+      ubx.keepPayload = (ubx.msgClass == UBX_CLASS_NAV && ubx.msgId == UBX_ID_NAV_PVT &&
+                         ubx.length == UBX_NAV_PVT_LEN);
+      break;
+    case UBX_READ_PAYLOAD:
+      if (ubx.keepPayload) ubx.payload[ubx.index] = c;
+      ubx.index++;
+      break;
+    case UBX_READ_CK_A:
+      if (c != ubx.ckA) {
+        ubx.badChecksum++;
+        ubx.state = UBX_WAIT_SYNC1;
+      } else {
+        ubx.state = UBX_READ_CK_B;
+      }
+      return false;
+    case UBX_READ_CK_B:
+      ubx.state = UBX_WAIT_SYNC1;
+      if (c != ubx.ckB) {
+        ubx.badChecksum++;
+        return false;
+      }
+      return ubx.keepPayload;
+  }
+
+  // Fletcher-8 over class, id, length and payload
+  ubx.ckA += c;
+  ubx.ckB += ubx.ckA;
+
+  if (ubx.state == UBX_READ_ID) {
+    ubx.state = UBX_READ_LEN1;
+  } else if (ubx.state == UBX_READ_LEN1) {
+    ubx.state = UBX_READ_LEN2;
+  } else if (ubx.state == UBX_READ_LEN2 || ubx.state == UBX_READ_PAYLOAD) {
+    ubx.state = (ubx.index >= ubx.length) ? UBX_READ_CK_A : UBX_READ_PAYLOAD;
+  }
+  return false;
+}
+
+// Decode the NAV-PVT fields updateGPSData() needs straight out of the parser buffer
+inline void fillFixFromNavPVT(Fix &fix, const uint8_t *pvt) {
+  uint8_t fixType = pvt[20];
+  bool gnssFixOK = (pvt[21] & 0x01) != 0;
+
+  fix.gpsTimeMs = (uint32_t)ubxI32(pvt + 0);        // iTOW, ms
+  if ((pvt[11] & 0x03) == 0x03) {                    // validDate and validTime
+    fix.utcEpoch = utcToEpoch(ubxU16(pvt + 4), pvt[6], pvt[7], pvt[8], pvt[9], pvt[10]);
+  }
+
+  fix.satellites = pvt[23];
+  fix.satellitesValid = true;
+
+  fix.locationValid = gnssFixOK && fixType >= 2;
+  if (fix.locationValid) {
+    fix.lon = ubxI32(pvt + 24) * 1e-7;
+    fix.lat = ubxI32(pvt + 28) * 1e-7;
+  }
+
+  fix.altitudeValid = gnssFixOK && fixType >= 3;
+  if (fix.altitudeValid) {
+    fix.altMeters = ubxI32(pvt + 36) / 1000.0;   // hMSL, mm
+  }
+
+  fix.speedValid = gnssFixOK;
+  fix.courseValid = gnssFixOK;
+  if (gnssFixOK) {
+    fix.speedKmph = ubxI32(pvt + 60) * 0.0036;   // gSpeed, mm/s
+    fix.courseDeg = ubxI32(pvt + 64) * 1e-5;     // headMot, 1e-5 deg
+  }
+}
+
+#endif // UBX_H
@@ -0,0 +1,250 @@
+// Dirty-rectangle partial updates for the main navigation screen.
+//
+// Each live element of the frame (battery level, satellite count, centre
+// distance, ...) is drawn between widgetBegin() and widgetEnd(). Every pixel
+// Adafruit_GFX writes goes through drawPixel(), so WidgetDisplay records the
+// open widget's bounding box and a hash of its pixels without the drawing
+// code knowing. At widgetFrameEnd() any widget whose hash or box changed
+// contributes its old and new boxes to the dirty area, and only that window
+// is sent to the panel. Nothing changed, nothing is sent.
+//
+// The dirty boxes are merged into a single window: on this controller each
+// updateWindow() is its own panel refresh, which takes far longer than
+// clocking even the full 5000-byte frame over SPI.
+//
+// Before anything is sent, a per-row hash of the finished buffer is compared
+// with the rows last pushed. Identical buffer, no refresh - even if a widget
+// redrew. The window spans every row that differs. When all of them lie
+// within the rows of the dirty boxes, the boxes give the columns; a changed
+// row anywhere else makes the window full width. Drawing that bypasses the
+// widgets inside their rows must call widgetInvalidate(), since the hashes
+// can't tell which columns of a row changed.
+//
+// The buffer always holds the complete frame, so pushing any window that
+// covers the changed pixels is correct. Anything else that pushes to the
+// panel (messages, other screens) calls updateWindow()/update() directly,
+// which makes the next widget frame a full-window update.
+//
+// Partial refreshes leave ghosting behind. widgetRequestClean() makes the
+// next frame that changes anything a full, flashing update() instead;
+// pushesSinceClean counts the partial refreshes since the last one.
+
+#ifndef WIDGETS_H
+#define WIDGETS_H
+
+#include <stdint.h>
+#include <GxEPD.h>
+#include <GxDEPG0150BN/GxDEPG0150BN.h>
+#include "framebuffer.h"
+
+#define WIDGET_BATTERY    0
+#define WIDGET_SATELLITES 1
+#define WIDGET_FUEL       2
+#define WIDGET_ALTITUDE   3
+#define WIDGET_CENTRE     4   // Distance and "To X" label
+#define WIDGET_SPEED      5
+#define WIDGET_COMPASS    6
+#define WIDGET_TARGETS    7   // Ring icons
+#define WIDGET_COUNT      8
+
+#define WIDGET_HASH_SEED 2166136261u   // FNV-1a
+#define WIDGET_HASH_PRIME 16777619u
+#define WIDGET_ROW_BYTES (GxDEPG0150BN_WIDTH / 8)
+#define WIDGET_ROWS GxDEPG0150BN_HEIGHT
+
+// Inclusive pixel bounds, empty when x1 < x0
+struct WidgetRect {
+  int16_t x0, y0, x1, y1;
+};
+
+inline WidgetRect widgetRectEmpty() {
+  WidgetRect r = { 0, 0, -1, -1 };
+  return r;
+}
+
+inline bool widgetRectIsEmpty(const WidgetRect &r) {
+  return r.x1 < r.x0;
+}
+
+inline bool widgetRectEqual(const WidgetRect &a, const WidgetRect &b) {
+  return a.x0 == b.x0 && a.y0 == b.y0 && a.x1 == b.x1 && a.y1 == b.y1;
+}
+
+inline WidgetRect widgetRectUnion(const WidgetRect &a, const WidgetRect &b) {
+  if (widgetRectIsEmpty(a)) return b;
+  if (widgetRectIsEmpty(b)) return a;
+  WidgetRect r = { a.x0 < b.x0 ? a.x0 : b.x0, a.y0 < b.y0 ? a.y0 : b.y0,
+                   a.x1 > b.x1 ? a.x1 : b.x1, a.y1 > b.y1 ? a.y1 : b.y1 };
+  return r;
+}
+
+class WidgetDisplay : public GxEPD_Class {
+public:
+  WidgetDisplay(GxIO &io, int8_t rst, int8_t busy) : GxEPD_Class(io, rst, busy) {
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+      drawn[i] = widgetRectEmpty();
+      hash[i] = WIDGET_HASH_SEED;
+    }
+  }
+
+  void drawPixel(int16_t x, int16_t y, uint16_t color) {
+    GxEPD_Class::drawPixel(x, y, color);
+    if (open < 0 || x < 0 || y < 0 || x >= width() || y >= height()) return;
+
+    WidgetRect &r = frame[open];
+    if (widgetRectIsEmpty(r)) {
+      r.x0 = r.x1 = x;
+      r.y0 = r.y1 = y;
+    } else {
+      if (x < r.x0) r.x0 = x;
+      if (x > r.x1) r.x1 = x;
+      if (y < r.y0) r.y0 = y;
+      if (y > r.y1) r.y1 = y;
+    }
+    frameHash[open] = (frameHash[open] ^ ((uint32_t)x | ((uint32_t)y << 8) | ((uint32_t)(color != 0) << 16))) * WIDGET_HASH_PRIME;
+  }
+
+  // Any push outside widgetFrameEnd() leaves the panel out of step with the widget boxes
+  void updateWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool using_rotation = true) {
+    if (!pushing) {
+      stale = true;
+      pushesSinceClean++;
+    }
+    GxEPD_Class::updateWindow(x, y, w, h, using_rotation);
+  }
+
+  void update() {
+    stale = true;
+    pushesSinceClean = 0;
+    GxEPD_Class::update();
+  }
+
+  // The buffer was rebuilt outside the widgets (e.g. a new static layer)
+  void widgetInvalidate() {
+    stale = true;
+  }
+
+  // Next frame with changes is a full refresh that clears ghosting
+  void widgetRequestClean() {
+    clean = true;
+  }
+
+  void widgetFrameBegin() {
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+      frame[i] = widgetRectEmpty();
+      frameHash[i] = WIDGET_HASH_SEED;
+    }
+    frameOpen = true;
+    open = -1;
+  }
+
+  // Drawing written straight into the buffer (digits.h): the open widget covers box and
+  // folds contentHash in, as drawPixel() would for each pixel
+  void widgetTrack(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint32_t contentHash) {
+    if (open < 0 || x1 < x0 || y1 < y0) return;
+    WidgetRect box = { x0, y0, x1, y1 };
+    frame[open] = widgetRectUnion(frame[open], box);
+    frameHash[open] = (frameHash[open] ^ contentHash) * WIDGET_HASH_PRIME;
+  }
+
+  // Outside a widget frame (e.g. the GPS wait screen) drawing is not tracked
+  void widgetBegin(int widget) {
+    open = frameOpen ? widget : -1;
+  }
+
+  void widgetEnd() {
+    open = -1;
+  }
+
+  void widgetFrameEnd() {
+    widgetEnd();
+    frameOpen = false;
+
+    WidgetRect dirty = widgetRectEmpty();
+    for (int i = 0; i < WIDGET_COUNT; i++) {
+      if (frameHash[i] != hash[i] || !widgetRectEqual(frame[i], drawn[i])) {
+        dirty = widgetRectUnion(dirty, widgetRectUnion(drawn[i], frame[i]));
+      }
+      drawn[i] = frame[i];
+      hash[i] = frameHash[i];
+    }
+
+    // Rows that differ from what the panel shows
+    const uint8_t *buffer = frameBuffer(*this);
+    int firstRow = WIDGET_ROWS, lastRow = -1;
+    for (int row = 0; row < WIDGET_ROWS; row++) {
+      uint32_t h = WIDGET_HASH_SEED;
+      const uint8_t *p = buffer + row * WIDGET_ROW_BYTES;
+      for (int i = 0; i < WIDGET_ROW_BYTES; i++) {
+        h = (h ^ p[i]) * WIDGET_HASH_PRIME;
+      }
+      if (h != rowHash[row]) {
+        rowHash[row] = h;
+        if (row < firstRow) firstRow = row;
+        lastRow = row;
+      }
+    }
+
+    frames++;
+    pushing = true;
+    if (clean && (stale || lastRow >= 0)) {
+      GxEPD_Class::update();
+      cleanRefreshes++;
+      pushedBytes += (uint32_t)width() * height() / 8;
+      pushesSinceClean = 0;
+      stale = false;
+      clean = false;
+    } else if (stale) {
+      GxEPD_Class::updateWindow(0, 0, width(), height());
+      fullPushes++;
+      pushesSinceClean++;
+      pushedBytes += (uint32_t)width() * height() / 8;
+      stale = false;
+    } else if (lastRow >= 0) {
+      // The row hashes give the rows - every changed row is pushed, since all of them were
+      // committed above. The widget boxes narrow the columns only if they cover those rows.
+      int y0 = firstRow;
+      int y1 = lastRow;
+      if (widgetRectIsEmpty(dirty) || firstRow < dirty.y0 || lastRow > dirty.y1) {
+        dirty.x0 = 0;
+        dirty.x1 = width() - 1;
+      }
+
+      // The controller writes whole bytes, so widen to 8px columns
+      int x0 = dirty.x0 & ~7;
+      int x1 = (dirty.x1 | 7) < width() ? (dirty.x1 | 7) : width() - 1;
+      int w = x1 - x0 + 1;
+      int h = y1 - y0 + 1;
+      GxEPD_Class::updateWindow(x0, y0, w, h);
+      partialPushes++;
+      pushesSinceClean++;
+      pushedBytes += (uint32_t)w * h / 8;
+    } else {
+      skippedFrames++;
+    }
+    pushing = false;
+  }
+
+  // For GET_STATS
+  uint32_t frames = 0;
+  uint32_t fullPushes = 0;
+  uint32_t partialPushes = 0;
+  uint32_t skippedFrames = 0;       // Buffer identical to the panel, no refresh
+  uint32_t pushedBytes = 0;         // Frame bytes sent to the panel
+  uint32_t cleanRefreshes = 0;      // Full update()s from widgetRequestClean()
+  uint32_t pushesSinceClean = 0;    // Partial refreshes since the last full update(), any source
+
+private:
+  WidgetRect drawn[WIDGET_COUNT];   // Boxes currently shown on the panel
+  uint32_t hash[WIDGET_COUNT];
+  WidgetRect frame[WIDGET_COUNT];   // Boxes drawn in the frame being built
+  uint32_t frameHash[WIDGET_COUNT];
+  uint32_t rowHash[WIDGET_ROWS] = {};   // Per row of the last pushed buffer
+  int8_t open = -1;
+  bool frameOpen = false;
+  bool pushing = false;
+  bool stale = true;                // Panel content unknown until the first full push
+  bool clean = false;
+};
+
+#endif // WIDGETS_H
@@ -0,0 +1,171 @@
+// Host golden-image check and micro-benchmark for src/circle_spans.h.
+//
+//   g++ -O2 -std=c++11 -Isrc tools/circle_spans_check.cpp -o circle_spans_check && ./circle_spans_check
+//
+// Draws every radius 1..60 and the outer ring radii 87..89 into a GxEPD-layout
+// 200x200 1bpp buffer twice: once the way Adafruit_GFX fillCircle() and
+// drawCircle() do it (one drawPixel per pixel, vertical-line fan / eight-way
+// mirror) and once from the span tables. Both start from the same random
+// background, setting and clearing bits (black or white on either buffer
+// polarity), at every x across the screen edges. Any differing byte fails the
+// check. Then times one frame's circles both ways.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+#include "circle_spans.h"
+
+#define W 200
+#define H 200
+#define BUFFER_SIZE (W * H / 8)
+#define MAX_RADIUS 60
+
+// GxEPD drawPixel() for rotation 0
+static void drawPixel(uint8_t *buffer, int x, int y, bool bit) {
+  if (x < 0 || x >= W || y < 0 || y >= H) return;
+  int i = x / 8 + y * (W / 8);
+  if (bit) buffer[i] |= (1 << (7 - x % 8));
+  else buffer[i] &= (0xFF ^ (1 << (7 - x % 8)));
+}
+
+static void gfxVLine(uint8_t *buffer, int x, int y, int h, bool bit) {
+  for (int i = 0; i < h; i++) drawPixel(buffer, x, y + i, bit);
+}
+
+// Adafruit_GFX::drawCircle()
+static void gfxDrawCircle(uint8_t *buffer, int x0, int y0, int r, bool bit) {
+  int f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  drawPixel(buffer, x0, y0 + r, bit);
+  drawPixel(buffer, x0, y0 - r, bit);
+  drawPixel(buffer, x0 + r, y0, bit);
+  drawPixel(buffer, x0 - r, y0, bit);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    drawPixel(buffer, x0 + x, y0 + y, bit);
+    drawPixel(buffer, x0 - x, y0 + y, bit);
+    drawPixel(buffer, x0 + x, y0 - y, bit);
+    drawPixel(buffer, x0 - x, y0 - y, bit);
+    drawPixel(buffer, x0 + y, y0 + x, bit);
+    drawPixel(buffer, x0 - y, y0 + x, bit);
+    drawPixel(buffer, x0 + y, y0 - x, bit);
+    drawPixel(buffer, x0 - y, y0 - x, bit);
+  }
+}
+
+// Adafruit_GFX::fillCircle() + fillCircleHelper(corners 3, delta 0)
+static void gfxFillCircle(uint8_t *buffer, int x0, int y0, int r, bool bit) {
+  gfxVLine(buffer, x0, y0 - r, 2 * r + 1, bit);
+  int f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+  int delta = 1;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < (y + 1)) {
+      gfxVLine(buffer, x0 + x, y0 - y, 2 * y + delta, bit);
+      gfxVLine(buffer, x0 - x, y0 - y, 2 * y + delta, bit);
+    }
+    if (y != py) {
+      gfxVLine(buffer, x0 + py, y0 - px, 2 * px + delta, bit);
+      gfxVLine(buffer, x0 - py, y0 - px, 2 * px + delta, bit);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+static uint8_t background[BUFFER_SIZE], expected[BUFFER_SIZE], actual[BUFFER_SIZE];
+static long cases = 0, failures = 0;
+
+static void compare(const char *what, int r, int cx, int cy, bool bit) {
+  cases++;
+  if (memcmp(expected, actual, BUFFER_SIZE) != 0) {
+    failures++;
+    if (failures <= 10) printf("MISMATCH %s r=%d at %d,%d bit %d\n", what, r, cx, cy, bit);
+  }
+}
+
+template <int R>
+static void checkRadius() {
+  for (int bit = 0; bit < 2; bit++) {
+    for (int cy = -R - 1; cy <= H + R; cy += 13) {
+      for (int cx = -R - 1; cx <= W + R; cx++) {
+        memcpy(expected, background, BUFFER_SIZE);
+        memcpy(actual, background, BUFFER_SIZE);
+        gfxFillCircle(expected, cx, cy, R, bit);
+        circleFillSpans(actual, W, H, cx, cy, CircleSpans<R>::fill, R, bit);
+        compare("fill", R, cx, cy, bit);
+
+        memcpy(expected, background, BUFFER_SIZE);
+        memcpy(actual, background, BUFFER_SIZE);
+        gfxDrawCircle(expected, cx, cy, R, bit);
+        circleOutlineSpans(actual, W, H, cx, cy, CircleSpans<R>::outlineLo, CircleSpans<R>::outlineHi, R, bit);
+        compare("outline", R, cx, cy, bit);
+      }
+    }
+  }
+}
+
+template <int R> struct CheckRadii {
+  static void run() {
+    CheckRadii<R - 1>::run();
+    checkRadius<R>();
+  }
+};
+template <> struct CheckRadii<0> {
+  static void run() {}
+};
+
+int main() {
+  srand(1);
+  for (int i = 0; i < BUFFER_SIZE; i++) background[i] = rand() & 0xFF;
+
+  CheckRadii<MAX_RADIUS>::run();
+  checkRadius<87>();
+  checkRadius<88>();
+  checkRadius<89>();
+  printf("golden images: %ld cases, %ld differ\n", cases, failures);
+
+  // A busy frame: 27 target icons (fillCircle 15) and the compass ring (drawCircle 24),
+  // plus the message-box centre blanking (fillCircle 54)
+  const int rounds = 20000;
+  memset(actual, 0, BUFFER_SIZE);
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    for (int icon = 0; icon < 27; icon++) gfxFillCircle(actual, 30 + icon * 5, 40 + icon * 4, 15, true);
+    gfxDrawCircle(actual, 176, 176, 24, true);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    for (int icon = 0; icon < 27; icon++) circleFillSpans(actual, W, H, 30 + icon * 5, 40 + icon * 4, CircleSpans<15>::fill, 15, true);
+    circleOutlineSpans(actual, W, H, 176, 176, CircleSpans<24>::outlineLo, CircleSpans<24>::outlineHi, 24, true);
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) gfxFillCircle(actual, 100, 100, 54, false);
+  auto t3 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) circleFillSpans(actual, W, H, 100, 100, CircleSpans<54>::fill, 54, false);
+  auto t4 = std::chrono::steady_clock::now();
+
+  printf("27 icons + compass ring: drawPixel path %.0f ns, spans %.0f ns (host, drawPixel not virtual here)\n",
+         std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds,
+         std::chrono::duration<double, std::nano>(t2 - t1).count() / rounds);
+  printf("centre blanking r=54: drawPixel path %.0f ns, spans %.0f ns\n",
+         std::chrono::duration<double, std::nano>(t3 - t2).count() / rounds,
+         std::chrono::duration<double, std::nano>(t4 - t3).count() / rounds);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,136 @@
+// Host golden-image check for src/digits.h.
+//
+//   g++ -O2 -std=c++11 -Isrc tools/digits_check.cpp -o digits_check && ./digits_check
+//
+// Renders readout strings into a GxEPD-layout 200x200 1bpp buffer twice: once
+// the way Adafruit_GFX print() does it (drawChar bit stream, one drawPixel per
+// set bit) and once with digitsDraw(). Both start from the same random
+// background, for both buffer polarities, at every sub-byte x offset and
+// across all four screen edges. Any differing byte fails the check.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+
+#define PROGMEM
+
+// Same layout as Adafruit GFX gfxfont.h
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+#include "tahoma20pt7b.h"
+#include "digits.h"
+
+#define W 200
+#define H 200
+#define BUFFER_SIZE (W * H / 8)
+
+// GxEPD drawPixel() for rotation 0
+static void drawPixel(uint8_t *buffer, int x, int y, bool blackBit) {
+  if (x < 0 || x >= W || y < 0 || y >= H) return;
+  int i = x / 8 + y * (W / 8);
+  if (blackBit) buffer[i] |= (1 << (7 - x % 8));
+  else buffer[i] &= (0xFF ^ (1 << (7 - x % 8)));
+}
+
+// Adafruit_GFX write() + drawChar() for a custom font, text size 1, no wrap
+static void gfxPrint(uint8_t *buffer, const GFXfont *font, int x, int y, const char *s, bool blackBit) {
+  for (; *s; s++) {
+    uint8_t c = *s;
+    if (c < font->first || c > font->last) continue;
+    const GFXglyph *glyph = &font->glyph[c - font->first];
+    if (glyph->width > 0 && glyph->height > 0) {
+      const uint8_t *bitmap = font->bitmap;
+      uint16_t bo = glyph->bitmapOffset;
+      uint8_t bits = 0, bit = 0;
+      for (int yy = 0; yy < glyph->height; yy++) {
+        for (int xx = 0; xx < glyph->width; xx++) {
+          if (!(bit++ & 7)) bits = bitmap[bo++];
+          if (bits & 0x80) drawPixel(buffer, x + glyph->xOffset + xx, y + glyph->yOffset + yy, blackBit);
+          bits <<= 1;
+        }
+      }
+    }
+    x += glyph->xAdvance;
+  }
+}
+
+static DigitFont font;
+static uint8_t background[BUFFER_SIZE], expected[BUFFER_SIZE], actual[BUFFER_SIZE];
+
+int main() {
+  if (!digitFontBuild(font, &tahoma20pt7b)) {
+    printf("digitFontBuild failed\n");
+    return 1;
+  }
+  int bitsUsed = 0;
+  for (int i = 0; i < DIGIT_GLYPHS; i++) bitsUsed += font.glyph[i].stride * font.glyph[i].height;
+  printf("unpacked %d glyphs into %d bytes\n", DIGIT_GLYPHS, bitsUsed);
+
+  const char *strings[] = { "0", "7", " 12.4", "999.9", "1234", "-5", "480m", "m", ".", "-", " ",
+                            "0123456789", "  0.1", "-0.0m" };
+  const int stringCount = sizeof(strings) / sizeof(strings[0]);
+  srand(1);
+
+  long cases = 0, failures = 0;
+  for (int polarity = 0; polarity < 2; polarity++) {
+    bool blackBit = polarity == 1;
+    for (int s = 0; s < stringCount; s++) {
+      // Every x offset from off the left edge to off the right, baselines above, inside and below
+      for (int y = -10; y <= H + 40; y += 7) {
+        for (int x = -60; x <= W + 8; x++) {
+          for (int i = 0; i < BUFFER_SIZE; i++) background[i] = rand() & 0xFF;
+          memcpy(expected, background, BUFFER_SIZE);
+          memcpy(actual, background, BUFFER_SIZE);
+
+          gfxPrint(expected, &tahoma20pt7b, x, y, strings[s], blackBit);
+          DigitBox box;
+          digitsDraw(actual, W, H, font, x, y, strings[s], blackBit, box);
+
+          cases++;
+          if (memcmp(expected, actual, BUFFER_SIZE) != 0) {
+            failures++;
+            if (failures <= 10) printf("MISMATCH \"%s\" at %d,%d polarity %d\n", strings[s], x, y, polarity);
+          }
+        }
+      }
+    }
+  }
+  printf("golden images: %ld cases, %ld differ\n", cases, failures);
+
+  // Time the two readouts of a frame (distance and speed) both ways
+  const int rounds = 100000;
+  memset(actual, 0, BUFFER_SIZE);
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    gfxPrint(actual, &tahoma20pt7b, 70, 90, " 12.4", true);
+    gfxPrint(actual, &tahoma20pt7b, 85, 133, "38", true);
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    DigitBox box;
+    digitsDraw(actual, W, H, font, 70, 90, " 12.4", true, box);
+    digitsDraw(actual, W, H, font, 85, 133, "38", true, box);
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  printf("distance + speed per frame: drawPixel path %.0f ns, blitter %.0f ns (host, drawPixel not virtual here)\n",
+         std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds,
+         std::chrono::duration<double, std::nano>(t2 - t1).count() / rounds);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,365 @@
+#!/usr/bin/env python3
+"""
+Mini ENAV font subsetter
+
+The Tahoma fonts in fonts/ are full Adafruit GFX tables (0x20-0x7E). The
+firmware only prints numbers, a few labels and the settings screen, so this
+scans src/main.cpp for the text each font actually renders and writes cut-down
+copies of the used fonts to src/, which is what the firmware includes:
+
+  - the glyph range first..last is trimmed to the characters in use
+  - only those glyphs keep a bitmap, packed back to back; every other glyph in
+    the range becomes an empty entry (GFX indexes glyphs by c - first)
+  - glyph metrics are copied unchanged, so text renders exactly as before
+
+Which characters a font renders is worked out from the source: string and
+character literals printed while it is the current font (setFont() in file
+order), literals reaching a printed variable through assignments and
+sprintf/strcpy, and digits, '-', '.' and ' ' wherever a number is formatted.
+Every character found must exist in the full font or nothing is written.
+
+Runs as a PlatformIO pre-build step (extra_scripts in platformio.ini) and
+rewrites a header only when its content changes. By hand:
+
+    python tools/font_subset.py           # regenerate src/tahoma*.h
+    python tools/font_subset.py --check   # fail if src/ is out of date
+    python tools/font_subset.py --list    # show the characters per font
+"""
+
+import argparse
+import os
+import re
+import sys
+
+FONT_DIR = "fonts"
+SRC_DIR = "src"
+SOURCES = ["main.cpp"]
+
+NUMBER_CHARS = set(" -.0123456789")   # print(float), dtostrf, %d/%f, String(n)
+
+TOKEN = re.compile(r"""
+    (?P<comment>//[^\n]*|/\*.*?\*/)
+  | (?P<string>"(?:\\.|[^"\\])*")
+  | (?P<char>'(?:\\.|[^'\\])+')
+  | (?P<ident>[A-Za-z_]\w*)
+  | (?P<number>\d[\w.]*)
+  | (?P<op>==|!=|<=|>=|\+=|->|::|&&|\|\||\S)
+""", re.X | re.S)
+
+ESCAPES = {"n": "\n", "t": "\t", "r": "\r", "0": "\0", "\\": "\\", "'": "'", '"': '"'}
+
+PRINT_CALLS = {"print", "println", "printReadout"}
+FORMAT_CALLS = {"sprintf": 1, "snprintf": 2}       # Index of the format argument
+COPY_CALLS = {"strcpy", "strcat", "strncpy"}
+NUMBER_CALLS = {"dtostrf", "itoa", "ltoa", "utoa"}
+NOT_VALUES = {"String", "c_str", "sizeof", "substring", "char", "const", "true", "false",
+              "nullptr", "int", "float", "double", "long", "unsigned"}
+
+
+def unescape(literal):
+    body, out, i = literal[1:-1], [], 0
+    while i < len(body):
+        if body[i] == "\\" and i + 1 < len(body):
+            out.append(ESCAPES.get(body[i + 1], body[i + 1]))
+            i += 2
+        else:
+            out.append(body[i])
+            i += 1
+    return "".join(out)
+
+
+def tokenize(text):
+    return [(m.lastgroup, m.group()) for m in TOKEN.finditer(text) if m.lastgroup != "comment"]
+
+
+def split_args(tokens, start):
+    """Arguments of the call whose '(' is at start, and the index after ')'."""
+    args, current, depth, i = [], [], 0, start + 1
+    while i < len(tokens):
+        kind, value = tokens[i]
+        if value in "([{":
+            depth += 1
+        elif value in ")]}":
+            if depth == 0:
+                if current:
+                    args.append(current)
+                return args, i + 1
+            depth -= 1
+        elif value == "," and depth == 0:
+            args.append(current)
+            current = []
+            i += 1
+            continue
+        current.append(tokens[i])
+        i += 1
+    return args, i
+
+
+def format_chars(fmt):
+    """Literal characters of a printf format; True if it formats a number."""
+    chars, numeric = set(), False
+    for part in re.split(r"(%[-+ #0]*\d*(?:\.\d+)?[hlLzjt]*[diouxXeEfgGcs%])", fmt):
+        if not part.startswith("%"):
+            chars |= set(part)
+        elif part[-1] == "%":
+            chars.add("%")
+        elif part[-1] != "s":
+            numeric = True
+    return chars, numeric
+
+
+class Scanner:
+    """Which characters each font renders, from the firmware source."""
+
+    def __init__(self, tokens, digit_chars):
+        self.tokens = tokens
+        self.digit_chars = digit_chars
+        self.sources = {}     # Variable -> expressions assigned or formatted into it
+        self.used = {}        # Font -> set of characters
+        self.collect_sources()
+
+    def add_source(self, name, expr):
+        self.sources.setdefault(name, []).append(expr)
+
+    def collect_sources(self):
+        t = self.tokens
+        for i, (kind, value) in enumerate(t):
+            if kind != "ident":
+                continue
+            nxt = t[i + 1][1] if i + 1 < len(t) else ""
+            if nxt == "(" and (value in FORMAT_CALLS or value in COPY_CALLS or value in NUMBER_CALLS):
+                args, _ = split_args(t, i + 1)
+                if not args or not args[0]:
+                    continue
+                target = args[0][0][1]
+                if value in NUMBER_CALLS:
+                    self.add_source(target, [("number", "0")])
+                elif value in COPY_CALLS:
+                    self.add_source(target, args[1] if len(args) > 1 else [])
+                else:
+                    fmt = args[FORMAT_CALLS[value]] if len(args) > FORMAT_CALLS[value] else []
+                    for kind2, lit in fmt:
+                        if kind2 == "string":
+                            chars, numeric = format_chars(unescape(lit))
+                            self.add_source(target, [("text", "".join(chars))])
+                            if numeric:
+                                self.add_source(target, [("number", "0")])
+                    for arg in args[FORMAT_CALLS[value] + 1:]:
+                        self.add_source(target, arg)
+                continue
+
+            # name = expr, name[i] = expr, name += expr (also declarations)
+            j = i + 1
+            if nxt == "[":
+                _, j = split_args(t, i + 1)
+            if j < len(t) and t[j][1] in ("=", "+=") and (i == 0 or t[i - 1][1] not in (".", "->")):
+                expr, depth, k = [], 0, j + 1
+                while k < len(t):
+                    v = t[k][1]
+                    if v in "([{":
+                        depth += 1
+                    elif v in ")]}":
+                        if depth == 0:
+                            break
+                        depth -= 1
+                    elif v in (";", ",") and depth == 0:
+                        break
+                    expr.append(t[k])
+                    k += 1
+                self.add_source(value, expr)
+
+    def chars_of(self, expr, seen=None):
+        """Characters an expression can produce when printed."""
+        seen = set() if seen is None else seen
+        chars = set()
+        for i, (kind, value) in enumerate(expr):
+            if kind in ("string", "char"):
+                chars |= set(unescape(value))
+            elif kind == "text":
+                chars |= set(value)       # Format text, already unescaped
+            elif kind == "number":
+                chars |= NUMBER_CHARS
+            elif kind == "ident" and value not in NOT_VALUES:
+                if i > 0 and expr[i - 1][1] in (".", "->") and value not in self.sources:
+                    continue    # Method or field of something already counted
+                if value in seen:
+                    continue
+                seen.add(value)
+                if value in self.sources:
+                    for source in self.sources[value]:
+                        chars |= self.chars_of(source, seen)
+                elif not (i + 1 < len(expr) and expr[i + 1][1] == "("):
+                    chars |= NUMBER_CHARS   # A plain number variable
+        return chars
+
+    def fonts_of(self, expr, seen=None):
+        """Fonts an expression given to setFont() can name."""
+        seen = set() if seen is None else seen
+        fonts = set()
+        for i, (kind, value) in enumerate(expr):
+            if kind != "ident" or value in seen:
+                continue
+            if i > 0 and expr[i - 1][1] == "&":
+                fonts.add(value)
+            elif value in self.sources:
+                seen.add(value)
+                for source in self.sources[value]:
+                    fonts |= self.fonts_of(source, seen)
+        return fonts
+
+    def use(self, fonts, chars):
+        for font in fonts:
+            self.used.setdefault(font, set()).update(chars)
+
+    def scan(self):
+        t = self.tokens
+        current = set()
+        for i, (kind, value) in enumerate(t):
+            if kind != "ident" or i + 1 >= len(t) or t[i + 1][1] != "(":
+                continue
+            args, _ = split_args(t, i + 1)
+            receiver = t[i - 2][1] if i >= 2 and t[i - 1][1] == "." else None
+            if value == "setFont" and receiver == "display" and args:
+                current = self.fonts_of(args[0])
+            elif value in PRINT_CALLS and (receiver == "display" or value == "printReadout") and args:
+                chars = self.chars_of(args[0])
+                if len(args) > 1:
+                    chars |= NUMBER_CHARS   # print(value, decimals)
+                self.use(current, chars)
+            elif value == "textBounds" and len(args) == 2:
+                self.use(self.fonts_of(args[0]), self.chars_of(args[1]))
+            elif value == "digitFontBuild" and len(args) == 2:
+                self.use(self.fonts_of(args[1]), self.digit_chars)
+        return self.used
+
+
+class Font:
+    """An Adafruit GFX font header as written by fontconvert."""
+
+    def __init__(self, name, text):
+        self.name = name
+        bitmap = re.search(r"Bitmaps\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+        glyphs = re.search(r"Glyphs\[\]\s*PROGMEM\s*=\s*\{(.*?)\};", text, re.S)
+        font = re.search(r"GFXfont\s+\w+\s+PROGMEM\s*=\s*\{.*?,.*?,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(0x[0-9A-Fa-f]+|\d+)\s*,\s*(\d+)\s*\}", text, re.S)
+        if not (bitmap and glyphs and font):
+            raise ValueError("%s: not a GFX font header" % name)
+        self.bitmap = [int(b, 16) for b in re.findall(r"0x[0-9A-Fa-f]{2}", bitmap.group(1))]
+        self.glyphs = [tuple(int(v) for v in g) for g in
+                       re.findall(r"\{\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+),\s*(-?\d+)\s*\}", glyphs.group(1))]
+        self.first = int(font.group(1), 0)
+        self.last = int(font.group(2), 0)
+        self.y_advance = int(font.group(3))
+        if len(self.glyphs) != self.last - self.first + 1:
+            raise ValueError("%s: %d glyphs for range 0x%02X-0x%02X" % (name, len(self.glyphs), self.first, self.last))
+
+    def has(self, c):
+        return self.first <= ord(c) <= self.last
+
+    def glyph_bits(self, code):
+        offset, width, height = self.glyphs[code - self.first][:3]
+        return self.bitmap[offset:offset + (width * height + 7) // 8]
+
+    def subset(self, chars):
+        """Header text for the font cut down to chars."""
+        codes = sorted(ord(c) for c in chars)
+        first, last = codes[0], codes[-1]
+        keep = set(codes)
+
+        bitmap, glyphs = [], []
+        for code in range(first, last + 1):
+            if code in keep:
+                offset, width, height, advance, x_offset, y_offset = self.glyphs[code - self.first]
+                glyphs.append((len(bitmap), width, height, advance, x_offset, y_offset, code, True))
+                bitmap.extend(self.glyph_bits(code))
+            else:
+                glyphs.append((0, 0, 0, 0, 0, 0, code, False))
+        if not bitmap:
+            bitmap = [0x00]
+
+        name = self.name
+        out = ["// Generated by tools/font_subset.py from %s/%s.h - do not edit." % (FONT_DIR, name),
+               "// Characters: %s" % "".join(chr(c) for c in codes),
+               "",
+               "const uint8_t %sBitmaps[] PROGMEM = {" % name]
+        rows = ["  " + ", ".join("0x%02X" % b for b in bitmap[i:i + 12]) for i in range(0, len(bitmap), 12)]
+        out.append(",\n".join(rows) + " };")
+        out.append("")
+        out.append("constexpr GFXglyph %sGlyphs[] PROGMEM = {" % name)
+        for n, (offset, width, height, advance, x_offset, y_offset, code, used) in enumerate(glyphs):
+            sep = " }; " if n == len(glyphs) - 1 else ",   "
+            out.append("  { %5d, %3d, %3d, %3d, %4d, %4d }%s// 0x%02X '%s'%s" % (
+                offset, width, height, advance, x_offset, y_offset, sep, code, chr(code), "" if used else " (not used)"))
+        out.append("")
+        out.append("constexpr GFXfont %s PROGMEM = {" % name)
+        out.append("  (uint8_t  *)%sBitmaps," % name)
+        out.append("  (GFXglyph *)%sGlyphs," % name)
+        out.append("  0x%02X, 0x%02X, %d };" % (first, last, self.y_advance))
+        out.append("")
+        out.append("// Approx. %d bytes" % (len(bitmap) + 7 * len(glyphs) + 7))
+        return "\n".join(out) + "\n"
+
+
+def digit_chars(src):
+    """The readout blitter's characters (digits.h)."""
+    with open(os.path.join(src, "digits.h")) as f:
+        m = re.search(r'#define\s+DIGIT_CHARS\s+("(?:\\.|[^"\\])*")', f.read())
+    return set(unescape(m.group(1))) if m else set()
+
+
+def generate(root, check=False, listing=False, log=print):
+    """Regenerate the subset fonts under root. Returns the number of errors."""
+    src = os.path.join(root, SRC_DIR)
+    fonts = os.path.join(root, FONT_DIR)
+    tokens = []
+    for name in SOURCES:
+        with open(os.path.join(src, name)) as f:
+            tokens += tokenize(f.read())
+    used = Scanner(tokens, digit_chars(src)).scan()
+
+    errors = 0
+    for name in sorted(used):
+        path = os.path.join(fonts, name + ".h")
+        if not os.path.exists(path):
+            continue    # Library font (FreeMono...), not ours to subset
+        with open(path) as f:
+            font = Font(name, f.read())
+        chars = used[name]
+        missing = sorted(c for c in chars if not font.has(c))
+        if missing:
+            log("font_subset: %s has no glyph for %s" % (name, " ".join(repr(c) for c in missing)))
+            errors += 1
+            continue
+        if listing:
+            log("%-14s %3d glyphs  %s" % (name, len(chars), "".join(sorted(chars))))
+
+        text = font.subset(chars)
+        out = os.path.join(src, name + ".h")
+        current = open(out).read() if os.path.exists(out) else None
+        if current == text:
+            continue
+        if check:
+            log("font_subset: %s is out of date, run tools/font_subset.py" % os.path.relpath(out, root))
+            errors += 1
+        else:
+            with open(out, "w") as f:
+                f.write(text)
+            log("font_subset: wrote %s (%d glyphs)" % (os.path.relpath(out, root), len(chars)))
+    return errors
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--root", default=os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")),
+                        help="project directory (default: the one holding this tool)")
+    parser.add_argument("--check", action="store_true", help="only verify src/ is up to date")
+    parser.add_argument("--list", action="store_true", help="print the characters each font renders")
+    args = parser.parse_args()
+    sys.exit(1 if generate(args.root, args.check, args.list) else 0)
+
+
+if __name__ == "__main__":
+    main()
+elif "Import" in globals():
+    Import("env")   # noqa: F821 - run by PlatformIO as an extra script
+    if generate(env.subst("$PROJECT_DIR")):   # noqa: F821
+        env.Exit(1)   # noqa: F821
@@ -0,0 +1,144 @@
+// Host benchmark for src/geodesy.h against the TinyGPSPlus great-circle formulas.
+//
+//   g++ -O2 -std=c++17 -Isrc tools/geodesy_bench.cpp -o geodesy_bench && ./geodesy_bench
+//
+// Reports the worst distance and course error of the int32/float kernels per range band and
+// the time per call of both versions. Host timings show the ratio only; on the
+// watch (40 MHz, single-precision FPU) the gap is wider because the reference
+// runs on soft-float doubles.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "geodesy.h"
+
+// TinyGPSPlus 1.0.x distanceBetween / courseTo
+static double refDistance(double lat1, double long1, double lat2, double long2) {
+  double delta = (long1 - long2) * GEO_DEG_TO_RAD;
+  double sdlong = sin(delta);
+  double cdlong = cos(delta);
+  lat1 *= GEO_DEG_TO_RAD;
+  lat2 *= GEO_DEG_TO_RAD;
+  double slat1 = sin(lat1), clat1 = cos(lat1);
+  double slat2 = sin(lat2), clat2 = cos(lat2);
+  delta = (clat1 * slat2) - (slat1 * clat2 * cdlong);
+  delta = delta * delta;
+  delta += (clat2 * sdlong) * (clat2 * sdlong);
+  delta = sqrt(delta);
+  double denom = (slat1 * slat2) + (clat1 * clat2 * cdlong);
+  delta = atan2(delta, denom);
+  return delta * 6372795;
+}
+
+static double refCourse(double lat1, double long1, double lat2, double long2) {
+  double dlon = (long2 - long1) * GEO_DEG_TO_RAD;
+  lat1 *= GEO_DEG_TO_RAD;
+  lat2 *= GEO_DEG_TO_RAD;
+  double a1 = sin(dlon) * cos(lat2);
+  double a2 = sin(lat1) * cos(lat2) * cos(dlon);
+  a2 = cos(lat1) * sin(lat2) - a2;
+  a2 = atan2(a1, a2);
+  if (a2 < 0.0) a2 += 2 * M_PI;
+  return a2 * GEO_RAD_TO_DEG;
+}
+
+struct Case {
+  double lat1, lon1, lat2, lon2;   // Double-precision positions
+  GeoPoint a, b;                   // The same positions as stored on the watch
+};
+
+// Targets at a random range in [minM, maxM] and random direction from a random origin
+static std::vector<Case> makeCases(std::mt19937 &rng, int n, double minM, double maxM, double maxLat) {
+  std::uniform_real_distribution<double> lat(-maxLat, maxLat), lon(-180.0, 180.0);
+  std::uniform_real_distribution<double> range(minM, maxM), dir(0.0, 2 * M_PI);
+  std::vector<Case> cases;
+  for (int i = 0; i < n; i++) {
+    Case c;
+    c.lat1 = lat(rng);
+    c.lon1 = lon(rng);
+    double r = range(rng), d = dir(rng);
+    c.lat2 = c.lat1 + r * cos(d) / (GEO_EARTH_RADIUS_M * GEO_DEG_TO_RAD);
+    c.lon2 = c.lon1 + r * sin(d) / (GEO_EARTH_RADIUS_M * GEO_DEG_TO_RAD * cos(c.lat1 * GEO_DEG_TO_RAD));
+    if (c.lon2 > 180.0) c.lon2 -= 360.0;
+    if (c.lon2 < -180.0) c.lon2 += 360.0;
+    c.a = geoPoint(c.lat1, c.lon1);
+    c.b = geoPoint(c.lat2, c.lon2);
+    cases.push_back(c);
+  }
+  return cases;
+}
+
+// Kernel error against the double reference on the same (quantised) points, plus the
+// extra error of storing the points as int32 1e-7 deg at all
+static void accuracy(const char *name, const std::vector<Case> &cases) {
+  double worstM = 0, worstRel = 0, worstDeg = 0, worstQuantM = 0;
+  for (const Case &c : cases) {
+    GeoOrigin o;
+    geoSetOrigin(o, c.a);
+    float course;
+    double d = geoVector(o, c.b, &course);
+    double lat1 = geoFromE7(c.a.lat), lon1 = geoFromE7(c.a.lon);
+    double lat2 = geoFromE7(c.b.lat), lon2 = geoFromE7(c.b.lon);
+    double refD = refDistance(lat1, lon1, lat2, lon2);
+    double refC = refCourse(lat1, lon1, lat2, lon2);
+    double errDeg = fabs(course - refC);
+    if (errDeg > 180.0) errDeg = 360.0 - errDeg;
+    worstM = fmax(worstM, fabs(d - refD));
+    worstRel = fmax(worstRel, fabs(d - refD) / refD);
+    worstDeg = fmax(worstDeg, errDeg);
+    worstQuantM = fmax(worstQuantM, fabs(refD - refDistance(c.lat1, c.lon1, c.lat2, c.lon2)));
+  }
+  printf("%-24s max err %8.3f m  %8.5f %%  %7.4f deg   (int32 storage %.3f m)\n",
+         name, worstM, worstRel * 100.0, worstDeg, worstQuantM);
+}
+
+template <typename F>
+static double nsPerCall(const std::vector<Case> &cases, F f) {
+  volatile double sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < 20; rep++)
+    for (const Case &c : cases) sink = sink + f(c);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() / (20.0 * cases.size());
+}
+
+int main() {
+  std::mt19937 rng(12345);
+  const int n = 200000;
+
+  accuracy("0-2 km, |lat|<60", makeCases(rng, n, 1.0, 2000.0, 60.0));
+  accuracy("2-20 km, |lat|<60", makeCases(rng, n, 2000.0, 20000.0, 60.0));
+  accuracy("0-20 km, |lat|<80", makeCases(rng, n, 1.0, 20000.0, 79.9));
+  accuracy("20-500 km (fallback)", makeCases(rng, n, 20001.0, 500000.0, 80.0));
+
+  std::vector<Case> cases = makeCases(rng, n, 1.0, 20000.0, 70.0);
+  double refNs = nsPerCall(cases, [](const Case &c) {
+    return refDistance(c.lat1, c.lon1, c.lat2, c.lon2) + refCourse(c.lat1, c.lon1, c.lat2, c.lon2);
+  });
+  double fastNs = nsPerCall(cases, [](const Case &c) {
+    GeoOrigin o;
+    geoSetOrigin(o, c.a);
+    float course;
+    float d = geoVector(o, c.b, &course);
+    return (double)d + course;
+  });
+  // As on the watch: one origin per frame shared by every target, so only the per-target cost counts
+  GeoOrigin shared;
+  geoSetOrigin(shared, cases[0].a);
+  for (Case &c : cases) {
+    c.b.lat += shared.pos.lat - c.a.lat;
+    c.b.lon += shared.pos.lon - c.a.lon;
+  }
+  double sharedNs = nsPerCall(cases, [&shared](const Case &c) {
+    float course;
+    float d = geoVector(shared, c.b, &course);
+    return (double)d + course;
+  });
+  printf("distance+course per target: TinyGPSPlus %.1f ns, geoVector %.1f ns (%.1fx), "
+         "shared origin %.1f ns (%.1fx)\n",
+         refNs, fastNs, refNs / fastNs, sharedNs, refNs / sharedNs);
+  return 0;
+}
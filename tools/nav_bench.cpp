@@ -0,0 +1,200 @@
+// Host benchmark of the per-frame navigation work before and after int32 coordinates.
+//
+//   g++ -O2 -std=c++11 -Isrc tools/nav_bench.cpp -o nav_bench && ./nav_bench
+//
+// One frame is what the firmware did for every display refresh before the
+// target table: set the projection origin at the render position, then
+// distance and course to home, takeoff, the 5 location points and the 20
+// waypoints, plus the route legs for the remaining distance. "double" is the
+// geodesy.h kernel as it was with double-degree coordinates (copied below,
+// great-circle fallback in double); "int32" is the current geodesy.h on
+// GeoPoint. "table" is what updateRenderState() runs per frame today:
+// targetTableRender()'s shift of the per-fix vectors. Targets are spread
+// from 1 to 30 km, so about a third take the great-circle fallback.
+//
+// Host timings show the ratio only. On the watch the double kernel runs on
+// soft-float, so the gap is wider; nav.frameUs / maxUs in GET_STATS is the
+// updateRenderState() time measured there.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "geodesy.h"
+
+#define BENCH_LOCATIONS 5
+#define BENCH_WAYPOINTS 20
+#define BENCH_TARGETS (2 + BENCH_LOCATIONS + BENCH_WAYPOINTS)
+#define BENCH_FRAMES 2000
+
+// geodesy.h before int32 coordinates: same projection, positions and fallback in double
+namespace before {
+
+struct Origin {
+  double lat;
+  double lon;
+  float cosLat;
+  float sinLat;
+  bool fast;
+};
+
+static void setOrigin(Origin &origin, double lat, double lon) {
+  origin.lat = lat;
+  origin.lon = lon;
+  float latRad = (float)(lat * GEO_DEG_TO_RAD);
+  origin.cosLat = cosf(latRad);
+  origin.sinLat = sinf(latRad);
+  origin.fast = fabs(lat) < 80.0;
+}
+
+static double greatCircle(double lat1, double lon1, double lat2, double lon2, double *courseDeg) {
+  double dLon = (lon2 - lon1) * GEO_DEG_TO_RAD;
+  double phi1 = lat1 * GEO_DEG_TO_RAD;
+  double phi2 = lat2 * GEO_DEG_TO_RAD;
+  double sdLon = sin(dLon), cdLon = cos(dLon);
+  double s1 = sin(phi1), c1 = cos(phi1);
+  double s2 = sin(phi2), c2 = cos(phi2);
+
+  if (courseDeg) {
+    double course = atan2(sdLon * c2, c1 * s2 - s1 * c2 * cdLon) * GEO_RAD_TO_DEG;
+    if (course < 0) course += 360.0;
+    *courseDeg = course;
+  }
+
+  double delta = c1 * s2 - s1 * c2 * cdLon;
+  double num = sqrt(delta * delta + (c2 * sdLon) * (c2 * sdLon));
+  double den = s1 * s2 + c1 * c2 * cdLon;
+  return atan2(num, den) * GEO_EARTH_RADIUS_M;
+}
+
+static float vector(const Origin &origin, double lat, double lon, float *courseDeg = nullptr) {
+  const float metresPerDeg = (float)(GEO_EARTH_RADIUS_M * GEO_DEG_TO_RAD);
+  double dLonD = lon - origin.lon;
+  if (dLonD > 180.0) dLonD -= 360.0;
+  else if (dLonD < -180.0) dLonD += 360.0;
+  float dLat = (float)(lat - origin.lat);
+  float dLon = (float)dLonD;
+
+  float cosMid = origin.cosLat - origin.sinLat * (dLat * (float)GEO_DEG_TO_RAD * 0.5f);
+  float x = dLon * metresPerDeg * cosMid;
+  float y = dLat * metresPerDeg;
+  float distance = sqrtf(x * x + y * y);
+
+  if (!origin.fast || distance > GEO_FAST_RANGE_M) {
+    double course;
+    double gc = greatCircle(origin.lat, origin.lon, lat, lon, courseDeg ? &course : nullptr);
+    if (courseDeg) *courseDeg = (float)course;
+    return (float)gc;
+  }
+
+  if (courseDeg) {
+    float course = atan2f(x, y) * (float)GEO_RAD_TO_DEG - 0.5f * dLon * origin.sinLat;
+    if (course < 0.0f) course += 360.0f;
+    else if (course >= 360.0f) course -= 360.0f;
+    *courseDeg = course;
+  }
+  return distance;
+}
+
+static float distance(double lat1, double lon1, double lat2, double lon2) {
+  Origin origin;
+  setOrigin(origin, lat1, lon1);
+  return vector(origin, lat2, lon2);
+}
+
+} // namespace before
+
+struct Position {
+  double lat, lon;
+  GeoPoint pos;
+};
+
+static Position position(double lat, double lon) {
+  Position p = { lat, lon, geoPoint(lat, lon) };
+  return p;
+}
+
+template <typename F>
+static double usPerFrame(const std::vector<Position> &frames, F f) {
+  volatile float sink = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int rep = 0; rep < 100; rep++)
+    for (const Position &p : frames) sink = sink + f(p);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::micro>(end - start).count() / (100.0 * frames.size());
+}
+
+int main() {
+  std::mt19937 rng(12345);
+  std::uniform_real_distribution<double> range(1000.0, 30000.0), dir(0.0, 2 * M_PI);
+  const double lat0 = 46.5, lon0 = 6.6;
+  const double metresPerDeg = GEO_EARTH_RADIUS_M * GEO_DEG_TO_RAD;
+
+  std::vector<Position> targets;
+  int fallback = 0;
+  for (int i = 0; i < BENCH_TARGETS; i++) {
+    double r = range(rng), d = dir(rng);
+    if (r > GEO_FAST_RANGE_M) fallback++;
+    targets.push_back(position(lat0 + r * cos(d) / metresPerDeg,
+                               lon0 + r * sin(d) / (metresPerDeg * cos(lat0 * GEO_DEG_TO_RAD))));
+  }
+  const Position *waypoints = &targets[2 + BENCH_LOCATIONS];
+
+  // Render positions along a straight 50 m/s track, a few per second
+  std::vector<Position> frames;
+  for (int i = 0; i < BENCH_FRAMES; i++) {
+    double north = i * 15.0;
+    frames.push_back(position(lat0 + north / metresPerDeg, lon0));
+  }
+
+  double doubleUs = usPerFrame(frames, [&](const Position &p) {
+    before::Origin origin;
+    before::setOrigin(origin, p.lat, p.lon);
+    float sum = 0.0f, course;
+    for (const Position &t : targets) sum += before::vector(origin, t.lat, t.lon, &course) + course;
+    for (int k = 0; k + 1 < BENCH_WAYPOINTS; k++) {
+      sum += before::distance(waypoints[k].lat, waypoints[k].lon, waypoints[k + 1].lat, waypoints[k + 1].lon);
+    }
+    return sum;
+  });
+
+  double int32Us = usPerFrame(frames, [&](const Position &p) {
+    GeoOrigin origin;
+    geoSetOrigin(origin, p.pos);
+    float sum = 0.0f, course;
+    for (const Position &t : targets) sum += geoVector(origin, t.pos, &course) + course;
+    for (int k = 0; k + 1 < BENCH_WAYPOINTS; k++) sum += geoDistance(waypoints[k].pos, waypoints[k + 1].pos);
+    return sum;
+  });
+
+  // Per-fix vectors from the first frame, shifted to each render position as targetTableRender() does
+  GeoOrigin fixOrigin;
+  geoSetOrigin(fixOrigin, frames[0].pos);
+  std::vector<float> east, north;
+  for (const Position &t : targets) {
+    float bearing;
+    float r = geoVector(fixOrigin, t.pos, &bearing);
+    east.push_back(r * sinf(bearing * (float)GEO_DEG_TO_RAD));
+    north.push_back(r * cosf(bearing * (float)GEO_DEG_TO_RAD));
+  }
+  double tableUs = usPerFrame(frames, [&](const Position &p) {
+    float ox, oy;
+    geoLocal(fixOrigin, p.pos, ox, oy);
+    float sum = 0.0f;
+    for (int i = 0; i < BENCH_TARGETS; i++) {
+      float x = east[i] - ox;
+      float y = north[i] - oy;
+      float course = atan2f(x, y) * (float)GEO_RAD_TO_DEG;
+      sum += sqrtf(x * x + y * y) + (course < 0.0f ? course + 360.0f : course);
+    }
+    return sum;
+  });
+
+  printf("frame: %d targets (%d past %.0f km) + %d route legs, %d render positions\n", BENCH_TARGETS, fallback,
+         GEO_FAST_RANGE_M / 1000.0f, BENCH_WAYPOINTS - 1, BENCH_FRAMES);
+  printf("per frame: double %.2f us, int32 %.2f us (%.1fx), table %.2f us (%.1fx) (host)\n", doubleUs, int32Us,
+         doubleUs / int32Us, tableUs, doubleUs / tableUs);
+  return 0;
+}
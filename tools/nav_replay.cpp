@@ -0,0 +1,194 @@
+// Host replay of a recorded GPS log through the firmware's navigation core.
+//
+//   g++ -O2 -std=c++11 -Wall -Isrc tools/nav_replay.cpp -o nav_replay
+//   ./nav_replay flight.nmea [waypoints.txt] [--timeline out.csv]
+//   ./nav_replay flight.ubx --ubx [waypoints.txt] [--timeline out.csv]
+//
+// Takes the same logs tools/nmea_replay.py streams into a replay build, and
+// runs them through the same headers gpsTask and updateGPSData() use: nmea.h or
+// ubx.h a byte at a time, gpsClockMs() for the fix timestamps GPS_REPLAY uses,
+// navFilterUpdate(), and - when a waypoint file ("lat lon" per line, # comments)
+// is given - geodesy.h vectors and navSequencerUpdate() with the watch's 200 m
+// cylinder. Prints the decoder counters, the arrivals in order and the host
+// time per byte and per fix; --timeline writes one CSV row per fix.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <vector>
+
+#include "geodesy.h"
+#include "gps_fix.h"
+#include "nav_filter.h"
+#include "nav_sequence.h"
+#include "nmea.h"
+#include "ubx.h"
+
+#define REPLAY_GPS_TIMEOUT_MS 5000      // GPS_TIMEOUT in main.cpp
+#define REPLAY_REACHED_M 200.0f         // WAYPOINT_REACHED_DISTANCE in main.cpp
+#define REPLAY_MAX_WAYPOINTS 32         // Bits in NavWaypoints::active
+
+static bool readFile(const char *path, std::vector<uint8_t> &data) {
+  FILE *f = fopen(path, "rb");
+  if (!f) return false;
+  uint8_t buffer[4096];
+  size_t n;
+  while ((n = fread(buffer, 1, sizeof(buffer), f)) > 0) data.insert(data.end(), buffer, buffer + n);
+  fclose(f);
+  return true;
+}
+
+static bool readWaypoints(const char *path, std::vector<GeoPoint> &waypoints) {
+  FILE *f = fopen(path, "r");
+  if (!f) return false;
+  char line[128];
+  while (fgets(line, sizeof(line), f)) {
+    double lat, lon;
+    if (line[0] == '#' || sscanf(line, "%lf %lf", &lat, &lon) != 2) continue;
+    if (waypoints.size() == REPLAY_MAX_WAYPOINTS) break;
+    waypoints.push_back(geoPoint(lat, lon));
+  }
+  fclose(f);
+  return true;
+}
+
+int main(int argc, char **argv) {
+  const char *logPath = nullptr;
+  const char *waypointPath = nullptr;
+  const char *timelinePath = nullptr;
+  bool ubxLog = false;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--ubx") == 0) ubxLog = true;
+    else if (strcmp(argv[i], "--timeline") == 0 && i + 1 < argc) timelinePath = argv[++i];
+    else if (!logPath) logPath = argv[i];
+    else if (!waypointPath) waypointPath = argv[i];
+    else {
+      logPath = nullptr;
+      break;
+    }
+  }
+  if (!logPath) {
+    fprintf(stderr, "usage: %s log [waypoints.txt] [--ubx] [--timeline out.csv]\n", argv[0]);
+    return 2;
+  }
+
+  std::vector<uint8_t> log;
+  if (!readFile(logPath, log)) {
+    fprintf(stderr, "cannot read %s\n", logPath);
+    return 1;
+  }
+  std::vector<GeoPoint> waypointPos;
+  if (waypointPath && !readWaypoints(waypointPath, waypointPos)) {
+    fprintf(stderr, "cannot read %s\n", waypointPath);
+    return 1;
+  }
+  FILE *timeline = nullptr;
+  if (timelinePath) {
+    timeline = fopen(timelinePath, "w");
+    if (!timeline) {
+      fprintf(stderr, "cannot write %s\n", timelinePath);
+      return 1;
+    }
+    fprintf(timeline, "seq,t_ms,lat,lon,alt_m,speed_kmh,filter_lat,filter_lon,waypoint,range_m,arrival\n");
+  }
+
+  // Decoding alone, for the per-byte cost the watch pays in gpsTask
+  {
+    NMEAParser nmea = {};
+    UBXParser ubx = {};
+    Fix fix = {};
+    uint32_t epochs = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (uint8_t c : log) {
+      if (ubxLog ? ubxEncode(ubx, c) : nmeaEncode(nmea, fix, (char)c)) epochs++;
+    }
+    double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    printf("decode: %zu bytes, %u epochs, %.1f ns/byte\n", log.size(), epochs, log.empty() ? 0.0 : ns / log.size());
+  }
+
+  NMEAParser nmea = {};
+  UBXParser ubx = {};
+  GpsClock clock = {};
+  NavFilter filter = {};
+  NavSequencer sequencer = {};
+  Fix fix = {};
+  uint32_t wrapMs = ubxLog ? GPS_CLOCK_WRAP_UBX_MS : GPS_CLOCK_WRAP_NMEA_MS;
+
+  int count = (int)waypointPos.size();
+  std::vector<float> east(count), north(count), range(count);
+  NavWaypoints waypoints;
+  waypoints.count = count;
+  waypoints.active = count == REPLAY_MAX_WAYPOINTS ? 0xFFFFFFFFUL : (1UL << count) - 1;
+  waypoints.east = east.data();
+  waypoints.north = north.data();
+  waypoints.range = range.data();
+  uint8_t waypoint = 0;
+
+  uint32_t fixes = 0, located = 0;
+  double navNs = 0.0;
+  for (uint8_t c : log) {
+    bool complete;
+    if (ubxLog) {
+      complete = ubxEncode(ubx, c);
+      if (complete) fillFixFromNavPVT(fix, ubx.payload);
+    } else {
+      complete = nmeaEncode(nmea, fix, (char)c);
+    }
+    if (!complete) continue;
+
+    // What publishFix() and updateGPSData() do with each epoch
+    fixes++;
+    fix.seq = fixes;
+    fix.timestampMs = gpsClockMs(clock, fix.gpsTimeMs, wrapMs);
+
+    auto start = std::chrono::steady_clock::now();
+    navFilterUpdate(filter, fix, REPLAY_GPS_TIMEOUT_MS);
+    uint8_t arrived = waypoint;
+    uint8_t arrival = 0;
+    if (fix.locationValid && count > 0) {
+      GeoOrigin origin;
+      geoSetOrigin(origin, geoPoint(fix.lat, fix.lon));
+      for (int i = 0; i < count; i++) {
+        float bearing;
+        range[i] = geoVector(origin, waypointPos[i], &bearing);
+        float rad = bearing * (float)GEO_DEG_TO_RAD;
+        east[i] = range[i] * sinf(rad);
+        north[i] = range[i] * cosf(rad);
+      }
+      arrival = navSequencerUpdate(sequencer, waypoints, waypoint, REPLAY_REACHED_M);
+    }
+    navNs += std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    if (fix.locationValid) located++;
+
+    if (arrival) {
+      printf("t=%.1fs: waypoint %u reached by %s, next %u\n", fix.timestampMs / 1000.0, arrived,
+             arrival == NAV_ARRIVAL_CYLINDER ? "cylinder" : "bisector", waypoint);
+    }
+
+    if (timeline) {
+      double filterLat = 0.0, filterLon = 0.0, filterCourse = 0.0;
+      navFilterPredict(filter, fix.timestampMs, filterLat, filterLon, filterCourse);
+      fprintf(timeline, "%u,%u,%.7f,%.7f,%.1f,%.1f,%.7f,%.7f,%d,%.0f,%u\n", fix.seq, fix.timestampMs,
+              fix.locationValid ? fix.lat : 0.0, fix.locationValid ? fix.lon : 0.0, fix.altMeters, fix.speedKmph,
+              filterLat, filterLon, count > 0 ? waypoint : -1, count > 0 ? range[waypoint] : 0.0f, arrival);
+    }
+  }
+  if (timeline) fclose(timeline);
+
+  if (ubxLog) {
+    printf("ubx: %u NAV-PVT, %u bad checksum\n", fixes, (unsigned)ubx.badChecksum);
+  } else {
+    printf("nmea: %u accepted, %u dropped, %u decoded, %u bad checksum, %u incomplete epochs\n",
+           (unsigned)nmea.accepted, (unsigned)nmea.dropped, (unsigned)nmea.decoded, (unsigned)nmea.badChecksum,
+           (unsigned)nmea.incomplete);
+  }
+  printf("fixes: %u, %u with position, %.2f us/fix filter+nav\n", fixes, located, fixes ? navNs / fixes / 1000.0 : 0.0);
+  if (count > 0) {
+    printf("route: %u cylinder, %u bisector arrivals, on waypoint %u\n", sequencer.cylinderArrivals,
+           sequencer.bisectorArrivals, waypoint);
+  }
+  return 0;
+}
@@ -0,0 +1,191 @@
+#!/usr/bin/env python3
+"""
+Mini ENAV log replay
+
+Streams a recorded NMEA text log or UBX binary log into a replay build of the
+firmware over the USB serial port, and records the navigation state the
+device reports back after every fix.
+
+Build and flash the replay firmware first:
+
+    pio run -e replay --target upload
+
+Then replay a log at 1x, 100x or as fast as the device keeps up (--speed 0):
+
+    python tools/nmea_replay.py /dev/ttyUSB0 flight.nmea --speed 100 --timeline flight.csv
+    python tools/nmea_replay.py /dev/ttyUSB0 flight.ubx --ubx --speed 0
+
+Requires pyserial (pip install pyserial).
+"""
+
+import argparse
+import sys
+import threading
+import time
+
+import serial
+
+REPLAY_BAUD = 921600
+TIMELINE_HEADER = "seq,t_ms,lat,lon,alt_ft,speed_kmh,home_km,takeoff,waypoint,fuel_l,flight_h,nav_us"
+MAX_IN_FLIGHT = 8     # Fixes sent but not yet reported - keeps the device's fix queue from overflowing
+CREDIT_TIMEOUT = 1.0  # s - don't stall forever if a sentence produced no fix
+
+
+def nmea_records(path):
+    """Yield (log_seconds or None, bytes, produces_fix) per NMEA sentence.
+
+    The firmware publishes one fix per epoch, when the GGA and the RMC carrying
+    the same UTC time have both arrived, so only the second of each pair counts.
+    """
+    epoch_time = None
+    epoch_kinds = set()
+    with open(path, "rb") as f:
+        for raw in f:
+            line = raw.strip()
+            if not line.startswith(b"$"):
+                continue
+            fields = line.split(b",")
+            kind = fields[0][3:6]
+            t = None
+            if kind in (b"GGA", b"RMC") and len(fields) > 1 and len(fields[1]) >= 6:
+                try:
+                    hh, mm, ss = int(fields[1][0:2]), int(fields[1][2:4]), float(fields[1][4:])
+                    t = hh * 3600 + mm * 60 + ss
+                except ValueError:
+                    t = None
+            produces_fix = False
+            if t is not None:
+                if t != epoch_time:
+                    epoch_time = t
+                    epoch_kinds = set()
+                epoch_kinds.add(kind)
+                if len(epoch_kinds) == 2:
+                    produces_fix = True
+                    epoch_kinds = set()
+            yield t, line + b"\r\n", produces_fix
+
+
+def ubx_records(path):
+    """Yield (log_seconds or None, bytes, produces_fix) per UBX frame."""
+    with open(path, "rb") as f:
+        data = f.read()
+    i = 0
+    while i + 8 <= len(data):
+        if data[i] != 0xB5 or data[i + 1] != 0x62:
+            i += 1
+            continue
+        length = data[i + 4] | (data[i + 5] << 8)
+        end = i + 8 + length
+        if end > len(data):
+            break
+        frame = data[i:end]
+        is_pvt = frame[2] == 0x01 and frame[3] == 0x07 and length == 92
+        t = int.from_bytes(frame[6:10], "little") / 1000.0 if is_pvt else None
+        yield t, frame, is_pvt
+        i = end
+
+
+class Reader(threading.Thread):
+    """Collects REPLAY lines from the device."""
+
+    def __init__(self, port, timeline):
+        super().__init__(daemon=True)
+        self.port = port
+        self.timeline = timeline
+        self.count = 0
+        self.nav_us = 0
+        self.first = None
+        self.last = None
+        self.running = True
+        self.lock = threading.Lock()
+
+    def run(self):
+        while self.running:
+            raw = self.port.readline()
+            if not raw.startswith(b"REPLAY,"):
+                continue
+            row = raw[len(b"REPLAY,"):].decode("ascii", "replace").strip()
+            now = time.monotonic()
+            with self.lock:
+                self.count += 1
+                try:
+                    self.nav_us += int(row.rsplit(",", 1)[1])
+                except (IndexError, ValueError):
+                    pass
+                if self.first is None:
+                    self.first = now
+                self.last = now
+            if self.timeline:
+                self.timeline.write(row + "\n")
+
+    def reported(self):
+        with self.lock:
+            return self.count
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("port", help="USB serial port of the replay build")
+    parser.add_argument("log", help="recorded NMEA (text) or UBX (binary) log")
+    parser.add_argument("--ubx", action="store_true", help="log is UBX binary (firmware built with GPS_USE_UBX=1)")
+    parser.add_argument("--speed", type=float, default=1.0, help="replay speed factor, 0 = as fast as possible")
+    parser.add_argument("--timeline", help="write the per-fix state timeline to this CSV file")
+    args = parser.parse_args()
+
+    timeline = open(args.timeline, "w") if args.timeline else None
+    if timeline:
+        timeline.write(TIMELINE_HEADER + "\n")
+
+    port = serial.Serial(args.port, REPLAY_BAUD, timeout=0.2)
+    reader = Reader(port, timeline)
+    reader.start()
+
+    records = ubx_records(args.log) if args.ubx else nmea_records(args.log)
+    start_wall = time.monotonic()
+    start_log = None
+    sent_fixes = 0
+
+    for log_t, payload, produces_fix in records:
+        if args.speed > 0 and log_t is not None:
+            if start_log is None:
+                start_log = log_t
+            elapsed_log = log_t - start_log
+            if elapsed_log < 0:
+                elapsed_log += 86400 if not args.ubx else 604800
+            delay = start_wall + elapsed_log / args.speed - time.monotonic()
+            if delay > 0:
+                time.sleep(delay)
+
+        if produces_fix:
+            waited = time.monotonic()
+            while sent_fixes - reader.reported() >= MAX_IN_FLIGHT:
+                if time.monotonic() - waited > CREDIT_TIMEOUT:
+                    sent_fixes = reader.reported()
+                    break
+                time.sleep(0.001)
+            sent_fixes += 1
+
+        port.write(payload)
+
+    # Let the last fixes drain
+    deadline = time.monotonic() + 3.0
+    while reader.reported() < sent_fixes and time.monotonic() < deadline:
+        time.sleep(0.05)
+    reader.running = False
+    reader.join(timeout=1.0)
+    port.close()
+    if timeline:
+        timeline.close()
+
+    fixes = reader.count
+    span = (reader.last - reader.first) if fixes > 1 else 0.0
+    print("fixes reported: %d" % fixes)
+    if span > 0:
+        print("throughput:     %.1f fixes/s" % (fixes / span))
+    if fixes:
+        print("nav hot path:   %.0f us/fix (updateGPSData on device)" % (reader.nav_us / fixes))
+    return 0 if fixes else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,145 @@
+// Host check and benchmark for src/text_metrics.h.
+//
+//   g++ -O2 -std=c++11 -Ifonts -Isrc tools/text_metrics_check.cpp -o text_metrics_check && ./text_metrics_check
+//
+// Compares textBounds() and the compile-time textBoundsOf() with a copy of
+// Adafruit_GFX::getTextBounds() (charBounds, text size 1, no wrap) for every
+// string the main screen lays out with the Tahoma fonts, then times one frame's
+// worth of measurements both ways.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <stdint.h>
+
+#define PROGMEM
+
+// Same layout as Adafruit GFX gfxfont.h
+typedef struct {
+  uint16_t bitmapOffset;
+  uint8_t width;
+  uint8_t height;
+  uint8_t xAdvance;
+  int8_t xOffset;
+  int8_t yOffset;
+} GFXglyph;
+
+typedef struct {
+  uint8_t *bitmap;
+  GFXglyph *glyph;
+  uint16_t first;
+  uint16_t last;
+  uint8_t yAdvance;
+} GFXfont;
+
+#include "tahoma20pt7b.h"
+#include "tahoma15pt7b.h"
+#include "tahoma10pt7b.h"
+#include "text_metrics.h"
+
+// Evaluated by the compiler
+static_assert(textAdvance(tahoma20pt7b, "") == 0, "empty string has no advance");
+static_assert(textBoundsOf(tahoma20pt7b, "").w == 0, "empty string has no box");
+static_assert(textAdvance(tahoma20pt7b, "10") ==
+              tahoma20pt7bGlyphs['1' - 0x20].xAdvance + tahoma20pt7bGlyphs['0' - 0x20].xAdvance,
+              "advance is a table sum");
+
+// Adafruit_GFX::getTextBounds() for a 200px wide screen
+static void gfxTextBounds(const GFXfont *font, const char *str, int16_t *x1, int16_t *y1, uint16_t *w, uint16_t *h) {
+  int16_t x = 0, y = 0;
+  int16_t minx = 200, miny = 200, maxx = -1, maxy = -1;
+  uint8_t c;
+  *x1 = 0; *y1 = 0; *w = *h = 0;
+  while ((c = *str++)) {
+    if (c == '\n' || c == '\r') continue;
+    if (c < font->first || c > font->last) continue;
+    const GFXglyph *glyph = &font->glyph[c - font->first];
+    int16_t gx1 = x + glyph->xOffset, gy1 = y + glyph->yOffset;
+    int16_t gx2 = gx1 + glyph->width - 1, gy2 = gy1 + glyph->height - 1;
+    if (gx1 < minx) minx = gx1;
+    if (gy1 < miny) miny = gy1;
+    if (gx2 > maxx) maxx = gx2;
+    if (gy2 > maxy) maxy = gy2;
+    x += glyph->xAdvance;
+  }
+  if (maxx >= minx) { *x1 = minx; *w = maxx - minx + 1; }
+  if (maxy >= miny) { *y1 = miny; *h = maxy - miny + 1; }
+}
+
+static int checked = 0, mismatches = 0;
+
+static void check(const char *name, const GFXfont *font, const char *text) {
+  int16_t x, y; uint16_t w, h;
+  gfxTextBounds(font, text, &x, &y, &w, &h);
+  TextBounds b = textBounds(font, text);
+  TextBounds c = textBoundsOf(*font, text);
+  checked++;
+  if (b.x != x || b.y != y || b.w != w || b.h != h || c.x != x || c.y != y || c.w != w || c.h != h) {
+    mismatches++;
+    if (mismatches <= 10) {
+      printf("MISMATCH %s \"%s\": gfx %d,%d %ux%u table %d,%d %ux%u\n", name, text, x, y, w, h, b.x, b.y, b.w, b.h);
+    }
+  }
+}
+
+int main() {
+  const GFXfont *fonts[3] = { &tahoma20pt7b, &tahoma15pt7b, &tahoma10pt7b };
+  const char *names[3] = { "tahoma20", "tahoma15", "tahoma10" };
+  char buf[16];
+
+  for (int f = 0; f < 3; f++) {
+    // Distances (m, km with one decimal, whole km), speeds, altitudes in feet, fuel litres
+    for (int i = -999; i <= 30000; i++) {
+      snprintf(buf, sizeof(buf), "%d", i);
+      check(names[f], fonts[f], buf);
+    }
+    for (int i = 0; i <= 9999; i++) {
+      snprintf(buf, sizeof(buf), "%5.1f", i / 10.0);
+      check(names[f], fonts[f], buf);
+    }
+    // Icon labels and fixed strings
+    const char *labels[] = { "H", "T", "W1", "W5", "L1", "L5", "RT", "---", "Route", "To H", "Wait GPS", " ", "  " };
+    for (unsigned i = 0; i < sizeof(labels) / sizeof(labels[0]); i++) check(names[f], fonts[f], labels[i]);
+    // Every printable character alone and in pairs
+    for (int a = 0x20; a <= 0x7E; a++) {
+      for (int b = 0x20; b <= 0x7E; b++) {
+        buf[0] = (char)a; buf[1] = (char)b; buf[2] = 0;
+        check(names[f], fonts[f], buf);
+      }
+    }
+  }
+  printf("bounds: %d strings checked, %d differ from getTextBounds()\n", checked, mismatches);
+
+  // One main-screen frame: altitude, distance, integer part, speed, fuel, three icon labels.
+  // The FreeMono texts (label, satellites, compass letters) go through the same loop.
+  const int rounds = 200000;
+  int16_t x, y; uint16_t w, h;
+  unsigned sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    gfxTextBounds(&tahoma10pt7b, "2150", &x, &y, &w, &h); sink += w;
+    gfxTextBounds(&tahoma20pt7b, " 12.4", &x, &y, &w, &h); sink += w;
+    gfxTextBounds(&tahoma20pt7b, " 12", &x, &y, &w, &h); sink += w;
+    gfxTextBounds(&tahoma20pt7b, "38", &x, &y, &w, &h); sink += w;
+    gfxTextBounds(&tahoma10pt7b, "12.0", &x, &y, &w, &h); sink += w;
+    gfxTextBounds(&tahoma10pt7b, "H", &x, &y, &w, &h); sink += w;
+    gfxTextBounds(&tahoma10pt7b, "T", &x, &y, &w, &h); sink += w;
+    gfxTextBounds(&tahoma10pt7b, "W2", &x, &y, &w, &h); sink += w;
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (int i = 0; i < rounds; i++) {
+    sink += textBounds(&tahoma10pt7b, "2150").w;
+    sink += textBounds(&tahoma20pt7b, " 12.4").w;
+    sink += textBounds(&tahoma20pt7b, " 12").w;
+    sink += textBounds(&tahoma20pt7b, "38").w;
+    sink += textBounds(&tahoma10pt7b, "12.0").w;
+    sink += textBounds(&tahoma10pt7b, "H").w;
+    sink += textBounds(&tahoma10pt7b, "T").w;
+    sink += textBounds(&tahoma10pt7b, "W2").w;
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  printf("frame measurement: getTextBounds copy %.1f ns, textBounds %.1f ns (sink %u)\n",
+         std::chrono::duration<double, std::nano>(t1 - t0).count() / rounds,
+         std::chrono::duration<double, std::nano>(t2 - t1).count() / rounds, sink);
+  return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,92 @@
+#!/usr/bin/env python3
+"""
+Mini ENAV flight track decoder
+
+Decodes a dump of the "track" flash partition into one CSV row per recorded
+fix. Read the partition off the watch with esptool (offset and size from
+partitions_track.csv):
+
+    esptool.py read_flash 0x310000 0xF0000 track.bin
+    python tools/track_decode.py track.bin --out tracks.csv
+
+Blocks are ordered by sequence number; blocks that fail their CRC are
+reported and skipped.
+"""
+
+import argparse
+import struct
+import sys
+import zlib
+
+BLOCK_SIZE = 4096
+BLOCK_MAGIC = 0x314B5254  # "TRK1"
+HEADER = struct.Struct("<IIIIHHHH")
+CSV_HEADER = "flight,block,utc,t_ms,lat,lon,alt_m,speed_kmh"
+
+
+def varints(payload):
+    value = shift = 0
+    for byte in payload:
+        value |= (byte & 0x7F) << shift
+        if byte & 0x80:
+            shift += 7
+            continue
+        yield value
+        value = shift = 0
+
+
+def unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def decode_block(payload, count):
+    """Yield (t_ms, lat, lon, alt_m, speed_kmh) for each record in a block."""
+    fields = varints(payload)
+    t_ms = 0
+    prev = [0, 0, 0, 0]
+    for _ in range(count):
+        t_ms += next(fields)
+        for i in range(4):
+            prev[i] += unzigzag(next(fields))
+        yield t_ms, prev[0] / 1e7, prev[1] / 1e7, prev[2] / 10.0, prev[3] / 10.0
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode a Mini ENAV track partition dump")
+    parser.add_argument("dump", help="binary dump of the track partition")
+    parser.add_argument("--out", help="CSV output file (default stdout)")
+    parser.add_argument("--flight", type=int, help="only this flight number")
+    args = parser.parse_args()
+
+    with open(args.dump, "rb") as f:
+        data = f.read()
+
+    blocks = []
+    for offset in range(0, len(data) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        magic, seq, crc, start_epoch, flight, count, length, _ = HEADER.unpack_from(data, offset)
+        if magic != BLOCK_MAGIC:
+            continue
+        payload = data[offset + HEADER.size:offset + HEADER.size + length]
+        if zlib.crc32(payload) != crc:
+            print(f"block {seq} at 0x{offset:x}: bad CRC, skipped", file=sys.stderr)
+            continue
+        blocks.append((seq, start_epoch, flight, count, payload))
+    blocks.sort()
+
+    out = open(args.out, "w") if args.out else sys.stdout
+    out.write(CSV_HEADER + "\n")
+    fixes = 0
+    for seq, start_epoch, flight, count, payload in blocks:
+        if args.flight is not None and flight != args.flight:
+            continue
+        for t_ms, lat, lon, alt, speed in decode_block(payload, count):
+            utc = start_epoch + t_ms // 1000 if start_epoch else ""
+            out.write(f"{flight},{seq},{utc},{t_ms},{lat:.7f},{lon:.7f},{alt:.1f},{speed:.1f}\n")
+            fixes += 1
+    if out is not sys.stdout:
+        out.close()
+    print(f"{len(blocks)} blocks, {fixes} fixes", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
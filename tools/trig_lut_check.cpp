@@ -0,0 +1,214 @@
+// Host check for src/trig_lut.h against the float sin()/cos() drawing code it replaced.
+//
+//   g++ -O2 -std=c++11 -Isrc tools/trig_lut_check.cpp -o trig_lut_check && ./trig_lut_check
+//
+// Replays every point the display code projects (ring arcs, GPS wait dot, compass
+// rose ticks and letters, ring icons) through both versions and counts pixels that
+// differ. Whole-degree geometry must match exactly; the only tolerated differences
+// are where float rounding puts sin/cos a hair under an exact value such as 0.5 and
+// the old int() cast dropped a pixel. Fractional bearings are quantised to 1/8 deg,
+// which can move an icon by one pixel; those are reported separately.
+//
+// Also rasterises the static rings from the ring_geometry.h tables and compares them
+// with Adafruit_GFX::drawCircle() and the per-degree arc loop they replaced.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+#include "trig_lut.h"
+#include "ring_geometry.h"
+
+#define PI 3.1415926535897932384626433832795
+#define CENTER_X 100
+#define CENTER_Y 90
+#define INNER_RADIUS 55
+#define OUTER_RADIUS 89
+
+#define RING_WIDTH 3
+#define RING_MID_RADIUS        (INNER_RADIUS + (OUTER_RADIUS - INNER_RADIUS) / 3)
+#define RING_TWO_THIRDS_RADIUS (INNER_RADIUS + 2 * (OUTER_RADIUS - INNER_RADIUS) / 3)
+
+static int checked = 0, exactMismatch = 0, floatNoise = 0;
+
+// True when v*len is within float noise of a whole number, i.e. the old code's result
+// depended on which side of the integer float rounding happened to land
+static bool nearInteger(double v, int len) {
+  double p = std::fabs(v * len);
+  return std::fabs(p - std::floor(p + 0.5)) < 1e-5;
+}
+
+static void compare(const char *what, int oldX, int oldY, int newX, int newY, double c, double s, int len, int angle) {
+  checked++;
+  if (oldX == newX && oldY == newY) return;
+  if (nearInteger(c, len) || nearInteger(s, len)) {
+    floatNoise++;
+    return;
+  }
+  exactMismatch++;
+  if (exactMismatch <= 20) {
+    printf("MISMATCH %s len %d angle %d: old (%d,%d) new (%d,%d)\n", what, len, angle, oldX, oldY, newX, newY);
+  }
+}
+
+// 200x200 screen, one byte per pixel
+struct Raster {
+  unsigned char px[200][200];
+  Raster() { clear(); }
+  void clear() { for (int y = 0; y < 200; y++) for (int x = 0; x < 200; x++) px[y][x] = 0; }
+  void set(int x, int y) { if (x >= 0 && x < 200 && y >= 0 && y < 200) px[y][x] = 1; }
+  int diff(const Raster &o) const {
+    int n = 0;
+    for (int y = 0; y < 200; y++) for (int x = 0; x < 200; x++) n += px[y][x] != o.px[y][x];
+    return n;
+  }
+};
+
+// Adafruit_GFX::drawCircle
+static void gfxCircle(Raster &r, int x0, int y0, int radius) {
+  int f = 1 - radius, ddF_x = 1, ddF_y = -2 * radius, x = 0, y = radius;
+  r.set(x0, y0 + radius); r.set(x0, y0 - radius); r.set(x0 + radius, y0); r.set(x0 - radius, y0);
+  while (x < y) {
+    if (f >= 0) { y--; ddF_y += 2; f += ddF_y; }
+    x++; ddF_x += 2; f += ddF_x;
+    r.set(x0 + x, y0 + y); r.set(x0 - x, y0 + y); r.set(x0 + x, y0 - y); r.set(x0 - x, y0 - y);
+    r.set(x0 + y, y0 + x); r.set(x0 - y, y0 + x); r.set(x0 + y, y0 - x); r.set(x0 - y, y0 - x);
+  }
+}
+
+static void tableCircle(Raster &r, int radius, const int8_t *octant, int length) {
+  r.set(CENTER_X, CENTER_Y + radius); r.set(CENTER_X, CENTER_Y - radius);
+  r.set(CENTER_X + radius, CENTER_Y); r.set(CENTER_X - radius, CENTER_Y);
+  for (int x = 1; x < length; x++) {
+    int y = octant[x];
+    r.set(CENTER_X + x, CENTER_Y + y); r.set(CENTER_X - x, CENTER_Y + y);
+    r.set(CENTER_X + x, CENTER_Y - y); r.set(CENTER_X - x, CENTER_Y - y);
+    r.set(CENTER_X + y, CENTER_Y + x); r.set(CENTER_X - y, CENTER_Y + x);
+    r.set(CENTER_X + y, CENTER_Y - x); r.set(CENTER_X - y, CENTER_Y - x);
+  }
+}
+
+template <int Radius>
+static void tableCircle(Raster &r) {
+  tableCircle(r, Radius, CircleOctant<Radius>::y, sizeof(CircleOctant<Radius>::y));
+}
+
+// The per-degree drawRingWithGaps() loop
+static void loopArcs(Raster &r, int radius) {
+  static const int starts[4] = { 30, 120, 210, 300 };
+  for (int i = 0; i < RING_WIDTH; i++) {
+    for (int a = 0; a < 4; a++) {
+      for (int angle = starts[a]; angle <= starts[a] + 30; angle++) {
+        int x, y;
+        trigPointMath(CENTER_X, CENTER_Y, radius - i, trigAngle(angle), x, y);
+        r.set(x, y);
+      }
+    }
+  }
+}
+
+template <int Radius>
+static void tableArcs(Raster &r) {
+  const RingPoint *p = RingArcTable<Radius, RING_WIDTH>::points;
+  int count = sizeof(RingArcTable<Radius, RING_WIDTH>::points) / sizeof(RingPoint);
+  for (int i = 0; i < count; i++) {
+    r.set(CENTER_X + p[i].x, CENTER_Y - p[i].y); r.set(CENTER_X - p[i].x, CENTER_Y - p[i].y);
+    r.set(CENTER_X - p[i].x, CENTER_Y + p[i].y); r.set(CENTER_X + p[i].x, CENTER_Y + p[i].y);
+  }
+}
+
+// Whole static ring layer both ways; returns differing pixels
+static int checkRings() {
+  static Raster before, after;
+  for (int i = 0; i < RING_WIDTH; i++) {
+    gfxCircle(before, CENTER_X, CENTER_Y, OUTER_RADIUS - i);
+    gfxCircle(before, CENTER_X, CENTER_Y, INNER_RADIUS - i);
+  }
+  loopArcs(before, RING_MID_RADIUS);
+  loopArcs(before, RING_TWO_THIRDS_RADIUS);
+
+  tableCircle<OUTER_RADIUS>(after);
+  tableCircle<OUTER_RADIUS - 1>(after);
+  tableCircle<OUTER_RADIUS - 2>(after);
+  tableCircle<INNER_RADIUS>(after);
+  tableCircle<INNER_RADIUS - 1>(after);
+  tableCircle<INNER_RADIUS - 2>(after);
+  tableArcs<RING_MID_RADIUS>(after);
+  tableArcs<RING_TWO_THIRDS_RADIUS>(after);
+
+  // A spread of other radii, down to the degenerate ones
+  static Raster gfx, table;
+  int circleDiff = 0;
+  gfx.clear(); table.clear();
+  gfxCircle(gfx, CENTER_X, CENTER_Y, 1); tableCircle<1>(table);
+  gfxCircle(gfx, CENTER_X, CENTER_Y, 2); tableCircle<2>(table);
+  gfxCircle(gfx, CENTER_X, CENTER_Y, 11); tableCircle<11>(table);
+  gfxCircle(gfx, CENTER_X, CENTER_Y, 15); tableCircle<15>(table);
+  gfxCircle(gfx, CENTER_X, CENTER_Y, 24); tableCircle<24>(table);
+  circleDiff += gfx.diff(table);
+
+  return before.diff(after) + circleDiff;
+}
+
+int main() {
+  // drawArcSegment() over drawRingWithGaps() for both ring radii, and any radius up to the edge
+  for (int radius = 1; radius <= OUTER_RADIUS; radius++) {
+    for (int angle = 0; angle < 360; angle++) {
+      float radians = angle * PI / 180.0;
+      int oldX = CENTER_X + int(radius * cos(radians));
+      int oldY = CENTER_Y - int(radius * sin(radians));
+      int newX, newY;
+      trigPointMath(CENTER_X, CENTER_Y, radius, trigAngle(angle), newX, newY);
+      compare("arc", oldX, oldY, newX, newY, cos(radians), sin(radians), radius, angle);
+    }
+  }
+
+  // drawCompassRose() at every whole-degree heading
+  const int compassRadius = 24;
+  for (int heading = 0; heading < 360; heading++) {
+    for (int i = 0; i < 4; i++) {
+      int lengths[3] = { compassRadius - 2, compassRadius / 2, compassRadius - 10 };
+      for (int l = 0; l < 3; l++) {
+        float angle = (i * 90 - (float)heading) * PI / 180.0;
+        int oldX = (int)(cos(angle) * lengths[l]);
+        int oldY = (int)(sin(angle) * lengths[l]);
+        int newX, newY;
+        trigPointScreen(0, 0, lengths[l], trigAngle(i * 90 - heading), newX, newY);
+        compare("compass", oldX, oldY, newX, newY, cos(angle), sin(angle), lengths[l], i * 90 - heading);
+      }
+    }
+  }
+
+  // Ring icons at whole-degree relative bearings
+  const int iconRadius = INNER_RADIUS + 16;
+  for (int bearing = 0; bearing < 360; bearing++) {
+    float radians = bearing * PI / 180.0;
+    int oldX = CENTER_X + int(iconRadius * sin(radians));
+    int oldY = CENTER_Y - int(iconRadius * cos(radians));
+    int newX, newY;
+    trigPointBearing(CENTER_X, CENTER_Y, iconRadius, trigAngle(bearing), newX, newY);
+    compare("icon", oldX, oldY, newX, newY, cos(radians), sin(radians), iconRadius, bearing);
+  }
+
+  // Ring icons at fractional bearings: quantised to 1/8 deg, so off by at most one pixel
+  int fractional = 0, moved = 0, movedTooFar = 0;
+  for (int i = 0; i < 360 * 100; i++) {
+    float bearing = i / 100.0f;
+    float radians = bearing * PI / 180.0;
+    int oldX = CENTER_X + int(iconRadius * sin(radians));
+    int oldY = CENTER_Y - int(iconRadius * cos(radians));
+    int newX, newY;
+    trigPointBearing(CENTER_X, CENTER_Y, iconRadius, trigAngle(bearing), newX, newY);
+    fractional++;
+    if (oldX != newX || oldY != newY) moved++;
+    if (std::abs(oldX - newX) > 1 || std::abs(oldY - newY) > 1) movedTooFar++;
+  }
+
+  int ringDiff = checkRings();
+  printf("static rings: %d pixels differ from drawCircle() and the per-degree arc loop\n", ringDiff);
+  printf("whole-degree points: %d checked, %d differ by float noise only, %d real mismatches\n",
+         checked, floatNoise, exactMismatch);
+  printf("fractional bearings: %d checked, %d moved by one pixel, %d moved further\n",
+         fractional, moved, movedTooFar);
+  return (exactMismatch == 0 && movedTooFar == 0 && ringDiff == 0) ? 0 : 1;
+}
@@ -0,0 +1,285 @@
+// Host check for the UBX framer and NAV-PVT decoder in src/ubx.h.
+//
+//   g++ -O2 -std=c++11 -Isrc tools/ubx_check.cpp -o ubx_check && ./ubx_check
+//
+// Feeds NAV-PVT frames through ubxEncode() a byte at a time, the way gpsTask
+// does, and checks the fields fillFixFromNavPVT() decodes from them. The three
+// reference frames below are laid out as a u-blox M8 sends them at 1 Hz (UBX
+// protocol 15+, 92-byte payload): two consecutive 3D fixes and one from before
+// the first fix. Around them the stream carries what the receiver and the line
+// really produce: NMEA text, other UBX messages, older 84-byte NAV-PVT, frames
+// with a bad checksum byte or a flipped payload bit, frames cut off mid-payload,
+// and random noise. Then times the framer per byte.
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdint.h>
+#include <vector>
+
+#include "ubx.h"
+
+typedef std::vector<uint8_t> Bytes;
+
+// 2024-06-15 08:44:03 UTC, iTOW 463443000, 3D fix, 14 SV, 46.5197288 N 6.6323417 E,
+// hMSL 1563.400 m, gSpeed 8451 mm/s, headMot 271.31220 deg
+static const uint8_t pvtFix1[] = {
+  0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0x38, 0x94, 0x9F, 0x1B, 0xE8, 0x07, 0x06, 0x0F, 0x08, 0x2C,
+  0x03, 0x37, 0x19, 0x00, 0x00, 0x00, 0x40, 0x2B, 0xFE, 0xFF, 0x03, 0x01, 0xEA, 0x0E, 0xD9, 0x03,
+  0xF4, 0x03, 0xE8, 0x58, 0xBA, 0x1B, 0xE0, 0x98, 0x18, 0x00, 0x08, 0xDB, 0x17, 0x00, 0x08, 0x07,
+  0x00, 0x00, 0xC4, 0x09, 0x00, 0x00, 0x38, 0xE9, 0xFF, 0xFF, 0xE0, 0x17, 0x00, 0x00, 0x66, 0xFE,
+  0xFF, 0xFF, 0x03, 0x21, 0x00, 0x00, 0x54, 0xFD, 0x9D, 0x01, 0xA4, 0x01, 0x00, 0x00, 0x08, 0xC3,
+  0x02, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF8, 0x9D, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0xD8, 0x72
+};
+
+// One second later: 46.5197840 N 6.6322120 E, hMSL 1563.100 m, gSpeed 8390 mm/s, headMot 270.98000 deg
+static const uint8_t pvtFix2[] = {
+  0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0x20, 0x98, 0x9F, 0x1B, 0xE8, 0x07, 0x06, 0x0F, 0x08, 0x2C,
+  0x04, 0x37, 0x19, 0x00, 0x00, 0x00, 0x40, 0x2B, 0xFE, 0xFF, 0x03, 0x01, 0xEA, 0x0E, 0xC8, 0xFE,
+  0xF3, 0x03, 0x10, 0x5B, 0xBA, 0x1B, 0xB4, 0x97, 0x18, 0x00, 0xDC, 0xD9, 0x17, 0x00, 0x08, 0x07,
+  0x00, 0x00, 0xC4, 0x09, 0x00, 0x00, 0x38, 0xE9, 0xFF, 0xFF, 0xE0, 0x17, 0x00, 0x00, 0x66, 0xFE,
+  0xFF, 0xFF, 0xC6, 0x20, 0x00, 0x00, 0x90, 0x7B, 0x9D, 0x01, 0xA4, 0x01, 0x00, 0x00, 0x08, 0xC3,
+  0x02, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF8, 0x9D, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0xFA, 0xBA
+};
+
+// Before the first fix: iTOW 463300000, date/time not yet valid, fixType 0, 3 SV, position zero
+static const uint8_t pvtNoFix[] = {
+  0xB5, 0x62, 0x01, 0x07, 0x5C, 0x00, 0xA0, 0x65, 0x9D, 0x1B, 0xE8, 0x07, 0x06, 0x0F, 0x08, 0x29,
+  0x28, 0x00, 0x19, 0x00, 0x00, 0x00, 0x40, 0x2B, 0xFE, 0xFF, 0x00, 0x00, 0xEA, 0x03, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x07,
+  0x00, 0x00, 0xC4, 0x09, 0x00, 0x00, 0x38, 0xE9, 0xFF, 0xFF, 0xE0, 0x17, 0x00, 0x00, 0x66, 0xFE,
+  0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA4, 0x01, 0x00, 0x00, 0x08, 0xC3,
+  0x02, 0x00, 0x8E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xF8, 0x9D, 0x01, 0x00, 0x00,
+  0x00, 0x00, 0x66, 0xAA
+};
+
+static int checks = 0, failures = 0;
+
+static void expect(bool ok, const char *what) {
+  checks++;
+  if (!ok) {
+    failures++;
+    printf("FAIL %s\n", what);
+  }
+}
+
+static void expectNear(double got, double want, double tolerance, const char *what) {
+  checks++;
+  if (fabs(got - want) > tolerance) {
+    failures++;
+    printf("FAIL %s: got %.9f, want %.9f\n", what, got, want);
+  }
+}
+
+static Bytes bytesOf(const uint8_t *p, size_t n) {
+  return Bytes(p, p + n);
+}
+
+static void append(Bytes &stream, const Bytes &more) {
+  stream.insert(stream.end(), more.begin(), more.end());
+}
+
+// Any UBX message, framed and checksummed
+static Bytes ubxFrame(uint8_t msgClass, uint8_t msgId, const Bytes &payload) {
+  Bytes frame;
+  frame.push_back(UBX_SYNC1);
+  frame.push_back(UBX_SYNC2);
+  frame.push_back(msgClass);
+  frame.push_back(msgId);
+  frame.push_back(payload.size() & 0xFF);
+  frame.push_back(payload.size() >> 8);
+  append(frame, payload);
+  uint8_t ckA = 0, ckB = 0;
+  for (size_t i = 2; i < frame.size(); i++) {
+    ckA += frame[i];
+    ckB += ckA;
+  }
+  frame.push_back(ckA);
+  frame.push_back(ckB);
+  return frame;
+}
+
+// Run a stream through the framer; every completed NAV-PVT is decoded into its own Fix
+static std::vector<Fix> feed(UBXParser &ubx, const Bytes &stream) {
+  std::vector<Fix> fixes;
+  for (size_t i = 0; i < stream.size(); i++) {
+    if (ubxEncode(ubx, stream[i])) {
+      Fix fix = {};
+      fillFixFromNavPVT(fix, ubx.payload);
+      fixes.push_back(fix);
+    }
+  }
+  return fixes;
+}
+
+static void checkFix1(const Fix &fix) {
+  expect(fix.gpsTimeMs == 463443000u, "fix1 iTOW");
+  expect(fix.utcEpoch == 1718441043u, "fix1 UTC 2024-06-15 08:44:03");
+  expect(fix.locationValid && fix.altitudeValid && fix.speedValid && fix.courseValid, "fix1 valid flags");
+  expect(fix.satellitesValid && fix.satellites == 14, "fix1 satellites");
+  expectNear(fix.lat, 46.5197288, 1e-9, "fix1 lat");
+  expectNear(fix.lon, 6.6323417, 1e-9, "fix1 lon");
+  expectNear(fix.altMeters, 1563.4, 1e-9, "fix1 hMSL");
+  expectNear(fix.speedKmph, 8.451 * 3.6, 1e-9, "fix1 gSpeed");
+  expectNear(fix.courseDeg, 271.3122, 1e-9, "fix1 headMot");
+}
+
+static void checkFix2(const Fix &fix) {
+  expect(fix.gpsTimeMs == 463444000u, "fix2 iTOW");
+  expect(fix.utcEpoch == 1718441044u, "fix2 UTC");
+  expectNear(fix.lat, 46.519784, 1e-9, "fix2 lat");
+  expectNear(fix.lon, 6.632212, 1e-9, "fix2 lon");
+  expectNear(fix.altMeters, 1563.1, 1e-9, "fix2 hMSL");
+  expectNear(fix.speedKmph, 8.39 * 3.6, 1e-9, "fix2 gSpeed");
+  expectNear(fix.courseDeg, 270.98, 1e-9, "fix2 headMot");
+}
+
+int main() {
+  const Bytes fix1 = bytesOf(pvtFix1, sizeof(pvtFix1));
+  const Bytes fix2 = bytesOf(pvtFix2, sizeof(pvtFix2));
+  const Bytes noFix = bytesOf(pvtNoFix, sizeof(pvtNoFix));
+
+  // Clean frames, back to back, reported on their last byte only
+  {
+    UBXParser ubx = {};
+    size_t completedAt = 0;
+    for (size_t i = 0; i < fix1.size(); i++) {
+      if (ubxEncode(ubx, fix1[i])) completedAt = i + 1;
+    }
+    expect(completedAt == fix1.size(), "frame completes on CK_B");
+    Fix fix = {};
+    fillFixFromNavPVT(fix, ubx.payload);
+    checkFix1(fix);
+
+    std::vector<Fix> fixes = feed(ubx, fix2);
+    expect(fixes.size() == 1, "second frame decodes");
+    if (fixes.size() == 1) checkFix2(fixes[0]);
+    expect(ubx.badChecksum == 0, "no checksum errors on clean frames");
+  }
+
+  // Before the first fix: time of week and satellites only, position left alone
+  {
+    UBXParser ubx = {};
+    std::vector<Fix> fixes = feed(ubx, noFix);
+    expect(fixes.size() == 1, "no-fix frame decodes");
+    if (fixes.size() == 1) {
+      Fix fix = fixes[0];
+      expect(fix.gpsTimeMs == 463300000u, "no-fix iTOW");
+      expect(fix.utcEpoch == 0, "no UTC until validDate and validTime");
+      expect(!fix.locationValid && !fix.altitudeValid && !fix.speedValid && !fix.courseValid, "no-fix invalid flags");
+      expect(fix.satellitesValid && fix.satellites == 3, "no-fix satellites");
+    }
+    Fix kept = {};
+    kept.lat = 12.5;
+    kept.lon = -3.25;
+    fillFixFromNavPVT(kept, ubx.payload);
+    expect(kept.lat == 12.5 && kept.lon == -3.25, "no-fix keeps the previous position");
+  }
+
+  // What else is on the wire: NMEA, NAV-STATUS, ACK-ACK, an 84-byte NAV-PVT
+  {
+    UBXParser ubx = {};
+    Bytes stream;
+    const char *nmea = "$GNGGA,084403.00,4631.18373,N,00637.94050,E,1,14,0.71,1563.4,M,47.3,M,,*7B\r\n";
+    append(stream, Bytes(nmea, nmea + strlen(nmea)));
+    append(stream, ubxFrame(UBX_CLASS_NAV, 0x03, Bytes(16, 0x5A)));
+    append(stream, fix1);
+    append(stream, ubxFrame(0x05, 0x01, Bytes(2, 0x06)));
+    append(stream, ubxFrame(UBX_CLASS_NAV, UBX_ID_NAV_PVT, Bytes(84, 0xB5)));
+    append(stream, fix2);
+    std::vector<Fix> fixes = feed(ubx, stream);
+    expect(fixes.size() == 2, "only the two 92-byte NAV-PVT frames are reported");
+    if (fixes.size() == 2) {
+      checkFix1(fixes[0]);
+      checkFix2(fixes[1]);
+    }
+    expect(ubx.badChecksum == 0, "skipped messages are not checksum errors");
+  }
+
+  // Corrupted frames are dropped and counted; the next good frame still decodes
+  {
+    const size_t corrupt[] = { 6, 30, fix1.size() - 3, fix1.size() - 2, fix1.size() - 1 };
+    for (size_t c = 0; c < sizeof(corrupt) / sizeof(corrupt[0]); c++) {
+      for (int bit = 0; bit < 8; bit++) {
+        UBXParser ubx = {};
+        Bytes stream = fix1;
+        stream[corrupt[c]] ^= (uint8_t)(1 << bit);
+        append(stream, fix2);
+        std::vector<Fix> fixes = feed(ubx, stream);
+        char what[64];
+        snprintf(what, sizeof(what), "byte %u bit %d flipped", (unsigned)corrupt[c], bit);
+        expect(fixes.size() == 1 && fixes[0].gpsTimeMs == 463444000u, what);
+        expect(ubx.badChecksum == 1, "corrupted frame counted once");
+      }
+    }
+  }
+
+  // Cut off anywhere: the bytes after it are taken as the rest of the frame, so the checksum
+  // fails and the frames it overlaps are lost too. Nothing wrong is ever reported, and with
+  // the length capped at UBX_MAX_PAYLOAD the framer is back in step within that many bytes.
+  {
+    int worstLost = 0;
+    for (size_t cut = 1; cut < fix1.size(); cut++) {
+      UBXParser ubx = {};
+      Bytes stream(fix1.begin(), fix1.begin() + cut);
+      const int following = (UBX_MAX_PAYLOAD + 8) / (int)fix2.size() + 2;
+      for (int i = 0; i < following; i++) append(stream, fix2);
+      append(stream, fix1);
+      std::vector<Fix> fixes = feed(ubx, stream);
+      char what[64];
+      snprintf(what, sizeof(what), "truncated after %u bytes", (unsigned)cut);
+      bool ok = !fixes.empty() && fixes.back().gpsTimeMs == 463443000u;
+      for (size_t i = 0; i + 1 < fixes.size(); i++) {
+        ok = ok && fixes[i].gpsTimeMs == 463444000u;
+        if (ok) checkFix2(fixes[i]);
+      }
+      expect(ok, what);
+      if (ok) checkFix1(fixes.back());
+      int lost = following + 1 - (int)fixes.size();
+      if (lost > worstLost) worstLost = lost;
+    }
+    printf("truncated frame: at most %d following frames lost\n", worstLost);
+  }
+
+  // Noise: random bytes must not produce a fix unless they form a valid frame by chance
+  {
+    UBXParser ubx = {};
+    srand(1);
+    Bytes noise(4000000);
+    for (size_t i = 0; i < noise.size(); i++) noise[i] = rand() & 0xFF;
+    size_t reported = feed(ubx, noise).size();
+    expect(reported == 0, "random bytes report nothing");
+    for (int i = 0; i < (UBX_MAX_PAYLOAD + 8) / (int)fix1.size() + 2; i++) append(noise, fix1);
+    ubx = UBXParser();
+    std::vector<Fix> fixes = feed(ubx, noise);
+    expect(!fixes.empty(), "frames after noise decode");
+    for (size_t i = 0; i < fixes.size(); i++) checkFix1(fixes[i]);
+  }
+  printf("ubx: %d checks, %d failed\n", checks, failures);
+
+  // Framer cost at 10 Hz NAV-PVT: 100 bytes per fix
+  Bytes stream;
+  for (int i = 0; i < 1000; i++) append(stream, i & 1 ? fix2 : fix1);
+  UBXParser ubx = {};
+  const int rounds = 200;
+  uint32_t sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int r = 0; r < rounds; r++) {
+    for (size_t i = 0; i < stream.size(); i++) {
+      if (ubxEncode(ubx, stream[i])) {
+        Fix fix = {};
+        fillFixFromNavPVT(fix, ubx.payload);
+        sink += fix.gpsTimeMs;
+      }
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  printf("framer + decode: %.2f ns per byte, %.0f ns per NAV-PVT (host, sink %u)\n",
+         std::chrono::duration<double, std::nano>(t1 - t0).count() / (rounds * stream.size()),
+         std::chrono::duration<double, std::nano>(t1 - t0).count() / (rounds * 1000.0), sink);
+  return failures == 0 ? 0 : 1;
+}